@@ -0,0 +1,81 @@
+#ifndef ALEATORIO_HPP
+#define ALEATORIO_HPP
+
+#include <chrono> // steady_clock
+#include <cstdint> // uint64_t
+#include <random> // random_device
+#include <utility> // swap
+
+// Gerador xoshiro256** (Blackman e Vigna): rápido, com estado de 4 palavras
+// e sem estado global, para que cada busca tenha o seu e as execuções com
+// a mesma semente sejam reproduzíveis:
+class Xoshiro256
+{
+    public:
+        // semente: qualquer valor (expandido pelo splitmix64 nas 4 palavras do estado).
+        Xoshiro256(uint64_t semente)
+        {
+            for(unsigned int k = 0; k < 4; k++)
+            {
+                semente += 0x9e3779b97f4a7c15ull;
+                uint64_t z = semente;
+                z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ull;
+                z = (z ^ (z >> 27))*0x94d049bb133111ebull;
+                this->s[k] = z ^ (z >> 31);
+            }
+        }
+
+        // Retorna a próxima palavra aleatória:
+        uint64_t operator()()
+        {
+            uint64_t r = rotaciona(this->s[1]*5, 7)*9;
+            uint64_t t = this->s[1] << 17;
+            this->s[2] ^= this->s[0];
+            this->s[3] ^= this->s[1];
+            this->s[1] ^= this->s[2];
+            this->s[0] ^= this->s[3];
+            this->s[2] ^= t;
+            this->s[3] = rotaciona(this->s[3], 45);
+            return r;
+        }
+
+        // n: limite (não nulo).
+        // Retorna um inteiro em [0, n) pela multiplicação de 32 por 32 bits
+        // (sem divisão; o viés é desprezível para n pequeno diante de 2^32):
+        unsigned int sorteia(unsigned int n)
+        {
+            return (unsigned int)(((*this)() >> 32)*n >> 32);
+        }
+
+    private:
+        // Estado:
+        uint64_t s[4];
+
+        static uint64_t rotaciona(uint64_t v, unsigned int k)
+        {
+            return (v << k) | (v >> (64-k));
+        }
+};
+
+// V: vetor de elementos;
+// n: número de elementos;
+// g: gerador aleatório.
+// Embaralha os elementos por Fisher-Yates, em O(n):
+template<typename T>
+inline void embaralha(T* V, unsigned int n, Xoshiro256& g)
+{
+    for(unsigned int k = n; k > 1; k--)
+    {
+        std::swap(V[k-1], V[g.sorteia(k)]);
+    }
+}
+
+// Retorna uma semente não nula para execuções não reproduzíveis:
+inline uint64_t semente_aleatoria()
+{
+    uint64_t semente = (uint64_t(std::random_device()()) << 32) | std::random_device()();
+    semente ^= uint64_t(std::chrono::steady_clock::now().time_since_epoch().count());
+    return semente ? semente : 1;
+}
+
+#endif
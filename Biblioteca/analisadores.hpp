@@ -0,0 +1,315 @@
+#ifndef ANALISADORES_HPP
+#define ANALISADORES_HPP
+
+#include <algorithm> // min
+#include <atomic> // atomic
+#include <functional> // function
+#include <iostream> // ostream, cout, endl
+#include <map> // map
+#include <memory> // unique_ptr
+#include <string> // string
+#include <thread> // thread
+#include <utility> // move
+#include <vector> // vector
+
+#include "./gerador_de_bits.hpp"
+#include "./rainhas.hpp"
+#include "./sumidouro.hpp"
+#include "./verificador.hpp"
+
+// Análise de soluções alimentada diretamente pela enumeração: cada solução
+// é entregue uma única vez, no momento em que é encontrada. O resultado
+// parcial de um analisador pode ser juntado ao de outro do mesmo tipo, de
+// modo que cada linha de execução analise sua parte da busca com cópias
+// vazias dos analisadores e os resultados sejam juntados no fim:
+class Analisador
+{
+    public:
+        // Destrutor:
+        virtual ~Analisador() {}
+        // x: número de possibilidades;
+        // S: solução (válida apenas durante a chamada).
+        virtual void analisa(unsigned int x, const unsigned int* S) = 0;
+        // Retorna um analisador do mesmo tipo e configuração, sem resultado:
+        virtual std::unique_ptr<Analisador> novo() const = 0;
+        // outro: analisador criado por novo deste (ou deste criado por novo do outro).
+        // Acrescenta o resultado parcial do outro a este:
+        virtual void junta(const Analisador& outro) = 0;
+        // o: destino do relatório.
+        virtual void relata(std::ostream& o) const = 0;
+};
+
+// Conta as soluções e as sequências que não são solução:
+class AnalisadorDeValidacao : public Analisador
+{
+    public:
+        // x: número de possibilidades (informado de antemão, para que o
+        //    relatório o mostre mesmo se não há solução alguma).
+        AnalisadorDeValidacao(unsigned int x)
+        {
+            this->x = x;
+            this->n_sol = 0;
+            this->n_f_sol = 0;
+        }
+        void analisa(unsigned int x, const unsigned int* S) override
+        {
+            this->n_sol++;
+            // Se não for de fato solução:
+            if(!eh_solucao_de_bits(x, S))
+            {
+                this->n_f_sol++;
+            }
+        }
+        std::unique_ptr<Analisador> novo() const override
+        {
+            return std::unique_ptr<Analisador>(new AnalisadorDeValidacao(this->x));
+        }
+        void junta(const Analisador& outro) override
+        {
+            const AnalisadorDeValidacao& V = static_cast<const AnalisadorDeValidacao&>(outro);
+            this->n_sol += V.n_sol;
+            this->n_f_sol += V.n_f_sol;
+        }
+        void relata(std::ostream& o) const override
+        {
+            o << "Número de sequências geradas que não são solução do problema: " << this->n_f_sol << std::endl;
+            o << "Número de soluções encontradas para o problema (2, " << this->x << ")-Rainhas Padrão: "
+                << this->n_sol-this->n_f_sol << std::endl;
+        }
+        // Retorna o número de soluções de fato:
+        unsigned long long solucoes() const
+        {
+            return this->n_sol-this->n_f_sol;
+        }
+    private:
+        // Número de possibilidades:
+        unsigned int x;
+        // Sequências recebidas e as que não são solução:
+        unsigned long long n_sol;
+        unsigned long long n_f_sol;
+};
+
+// Histograma de uma medida das soluções (áreas, somas de exclusões etc.).
+// A medida deve poder ser chamada por várias linhas de execução ao mesmo tempo:
+class AnalisadorDeHistograma : public Analisador
+{
+    public:
+        // nome     : nome da medida, no plural (para o relatório);
+        // medida   : função chamada com (x, S), que retorna a medida da solução;
+        // completo : se o relatório lista a frequência de cada valor.
+        AnalisadorDeHistograma(const std::string& nome, std::function<double(unsigned int, const unsigned int*)> medida,
+                                bool completo = true)
+        {
+            this->nome = nome;
+            this->medida = medida;
+            this->completo = completo;
+        }
+        void analisa(unsigned int x, const unsigned int* S) override
+        {
+            this->H[this->medida(x, S)]++;
+        }
+        std::unique_ptr<Analisador> novo() const override
+        {
+            return std::unique_ptr<Analisador>(new AnalisadorDeHistograma(this->nome, this->medida, this->completo));
+        }
+        void junta(const Analisador& outro) override
+        {
+            for(const auto& v : static_cast<const AnalisadorDeHistograma&>(outro).H)
+            {
+                this->H[v.first] += v.second;
+            }
+        }
+        void relata(std::ostream& o) const override
+        {
+            o << "Número de " << this->nome << " distintas: " << this->H.size() << std::endl;
+            if(this->completo)
+            {
+                for(const auto& v : this->H)
+                {
+                    o << "    " << v.first << ": " << v.second << std::endl;
+                }
+            }
+        }
+        // Retorna a frequência de cada valor da medida:
+        const std::map<double, unsigned long long>& histograma() const
+        {
+            return this->H;
+        }
+    private:
+        // Nome da medida:
+        std::string nome;
+        // Medida de uma solução:
+        std::function<double(unsigned int, const unsigned int*)> medida;
+        // Se o relatório lista as frequências:
+        bool completo;
+        // Frequência de cada valor da medida:
+        std::map<double, unsigned long long> H;
+};
+
+// Chama uma função para cada solução (por exemplo, para imprimi-la). Não
+// tem resultado a juntar, então só faz sentido com uma linha de execução
+// ou com uma função que seja segura entre linhas:
+class AnalisadorDeFuncao : public Analisador
+{
+    public:
+        // f: função chamada com (x, S).
+        AnalisadorDeFuncao(std::function<void(unsigned int, const unsigned int*)> f)
+        {
+            this->f = f;
+        }
+        void analisa(unsigned int x, const unsigned int* S) override
+        {
+            this->f(x, S);
+        }
+        std::unique_ptr<Analisador> novo() const override
+        {
+            return std::unique_ptr<Analisador>(new AnalisadorDeFuncao(this->f));
+        }
+        void junta(const Analisador&) override {}
+        void relata(std::ostream&) const override {}
+    private:
+        // Função de processamento:
+        std::function<void(unsigned int, const unsigned int*)> f;
+};
+
+// Conjunto de analisadores alimentados pela mesma enumeração. Cada
+// solução recebida é entregue a todos, na ordem em que foram adicionados:
+class Analises : public Sumidouro
+{
+    public:
+        // A: analisador (o conjunto passa a ser seu dono).
+        // Retorna o analisador, para consulta após a análise:
+        template<typename T>
+        T* adiciona(T* A)
+        {
+            this->analisadores.emplace_back(A);
+            return A;
+        }
+        bool recebe(unsigned int x, const unsigned int* S) override
+        {
+            for(auto& A : this->analisadores)
+            {
+                A->analisa(x, S);
+            }
+            return true;
+        }
+        // Retorna um conjunto com analisadores novos dos mesmos tipos:
+        Analises novas() const
+        {
+            Analises R;
+            for(const auto& A : this->analisadores)
+            {
+                R.analisadores.push_back(A->novo());
+            }
+            return R;
+        }
+        // outras: conjunto criado por novas deste.
+        // Junta os resultados parciais, analisador a analisador:
+        void junta(const Analises& outras)
+        {
+            for(size_t k = 0; k < this->analisadores.size(); k++)
+            {
+                this->analisadores[k]->junta(*outras.analisadores[k]);
+            }
+        }
+        // o: destino do relatório.
+        void relata(std::ostream& o) const
+        {
+            for(const auto& A : this->analisadores)
+            {
+                A->relata(o);
+            }
+        }
+    private:
+        // Analisadores:
+        std::vector<std::unique_ptr<Analisador>> analisadores;
+};
+
+// x    : número de possibilidades (não nulo);
+// A    : analisadores;
+// n_t  : número de linhas de execução (0 ou 1 para a linha atual).
+// Enumera as soluções uma única vez e as entrega aos analisadores. Com
+// várias linhas, cada uma toma prefixos de duas rainhas de um contador
+// comum, analisa suas subárvores com cópias vazias dos analisadores, e as
+// cópias são juntadas a A ao fim (a ordem das soluções entre linhas não é
+// definida, mas o resultado juntado é o mesmo). Acima de X_MAX_DE_BITS, os
+// tabuleiros de bits não servem, e a enumeração é feita em uma linha pela
+// verificação adiante (requer Biblioteca/rainhas.cpp na compilação):
+inline void analisa_solucoes(unsigned int x, Analises& A, unsigned int n_t)
+{
+    // Se o tabuleiro não cabe em uma palavra:
+    if(x > X_MAX_DE_BITS)
+    {
+        Rainhas R(MOTOR_VERIFICACAO_ADIANTE);
+        R.gera(x, A);
+        return;
+    }
+    // Se há só uma linha ou o tabuleiro não tem prefixos de duas rainhas:
+    if(n_t <= 1 || x < 2)
+    {
+        gera_solucoes_de_bits(x, A);
+        return;
+    }
+
+    // Prefixos de duas rainhas (suas subárvores particionam a busca):
+    const unsigned int k = 2;
+    std::vector<unsigned int> P = prefixos_de_bits(x, k);
+    unsigned int n_prefixos = P.size()/k;
+    n_t = std::min(n_t, std::max(n_prefixos, 1u));
+
+    // Próximo prefixo a analisar:
+    std::atomic<unsigned int> proximo(0);
+    // Analisadores de cada linha:
+    std::vector<Analises> parciais;
+    for(unsigned int t = 0; t < n_t; t++)
+    {
+        parciais.push_back(A.novas());
+    }
+
+    std::vector<std::thread> trabalhadores;
+    for(unsigned int t = 0; t < n_t; t++)
+    {
+        trabalhadores.emplace_back([&, t]()
+        {
+            // Memória de trabalho da linha, reaproveitada entre prefixos:
+            std::vector<estado_de_bits> E;
+            std::vector<unsigned int> S;
+            for(unsigned int e = proximo++; e < n_prefixos; e = proximo++)
+            {
+                gera_solucoes_de_bits_com_memoria(x, k, P.data() + e*k, parciais[t], E, S);
+            }
+        });
+    }
+    for(auto& T : trabalhadores)
+    {
+        T.join();
+    }
+
+    // Junta os resultados parciais:
+    for(const auto& R : parciais)
+    {
+        A.junta(R);
+    }
+}
+
+// x: número de elementos;
+// S: vetor de naturais a ser imprimido.
+inline void imprime_vetor_de_naturais(unsigned int x, const unsigned int* S)
+{
+    // Abre vetor:
+    std::cout << "[";
+
+    // Para todos os elementos exceto o último:
+    for(unsigned int i = 0; i+1 < x; i++)
+    {
+        // Imprime elemento e separador:
+        std::cout << S[i] << ", ";
+    }
+    // Imprime o último elemento:
+    if(x) std::cout << S[x-1];
+
+    // Fecha vetor:
+    std::cout << "]";
+}
+
+#endif
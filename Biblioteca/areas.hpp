@@ -0,0 +1,129 @@
+#ifndef AREAS_HPP
+#define AREAS_HPP
+
+#include <algorithm> // sort
+#include <cstdint> // int64_t
+#include <iostream> // cout, endl
+#include <vector> // vector
+
+#include "./analisadores.hpp"
+
+// Área do polígono formado pelas rainhas de uma solução, sem trigonometria
+// nem ponto flutuante: as coordenadas são dobradas e transladadas para o
+// centro do tabuleiro, que passa a ter coordenadas inteiras (x-1, x-1) antes
+// da translação. A ordem angular usa o semiplano de cada vértice e o produto
+// vetorial, e a área dupla é acumulada em inteiros, então áreas iguais são
+// sempre iguais:
+
+// Vértice de um polígono em coordenadas dobradas relativas ao centro:
+typedef struct VerticeExato
+{
+    int64_t dx;         // 2*k - (x-1).
+    int64_t dy;         // 2*S[k] - (x-1).
+    unsigned int k;     // índice da rainha.
+} vertice_exato;
+
+// V: vértice.
+// Retorna 0 se o ângulo do vértice está em [0, pi) (ou é o centro) e 1 se está em [pi, 2*pi):
+inline int semiplano(const vertice_exato& V)
+{
+    return (V.dy < 0 || (V.dy == 0 && V.dx < 0)) ? 1 : 0;
+}
+
+// a, b: vértices.
+// Ordem crescente de ângulo (em [0, 2*pi), a partir do semieixo x positivo)
+// e decrescente de raio (se mesmo ângulo). O centro tem ângulo 0 e raio 0:
+inline bool precede_em_sentido_antihorario(const vertice_exato& a, const vertice_exato& b)
+{
+    int sa = semiplano(a), sb = semiplano(b);
+    if(sa != sb)
+    {
+        return sa < sb;
+    }
+    // Direções (a do centro é a do ângulo 0):
+    int64_t ax = a.dx, ay = a.dy, bx = b.dx, by = b.dy;
+    if(!ax && !ay)
+    {
+        ax = 1;
+    }
+    if(!bx && !by)
+    {
+        bx = 1;
+    }
+    // No mesmo semiplano, a precede b se b está à esquerda de a:
+    int64_t c = ax*by - ay*bx;
+    if(c)
+    {
+        return c > 0;
+    }
+    // Mesmo ângulo: o mais distante do centro primeiro:
+    return a.dx*a.dx + a.dy*a.dy > b.dx*b.dx + b.dy*b.dy;
+}
+
+// x: número de vértices;
+// S: solução de um problema (2, x)-Rainhas;
+// V: vértices ordenados (redimensionado para x, reaproveitável entre chamadas).
+// Ordena os vértices em sentido anti-horário em O(x log x):
+inline void ordena_vertices_exatos(unsigned int x, const unsigned int* S, std::vector<vertice_exato>& V)
+{
+    V.resize(x);
+    for(unsigned int k = 0; k < x; k++)
+    {
+        V[k] = {2*int64_t(k) - (int64_t(x)-1), 2*int64_t(S[k]) - (int64_t(x)-1), k};
+    }
+    std::sort(V.begin(), V.end(), precede_em_sentido_antihorario);
+}
+
+// V: vértices ordenados de um polígono sem entrelaçamentos.
+// Retorna o dobro da área pela fórmula de Shoelace. A fórmula não depende
+// da translação, e com coordenadas dobradas a soma é 4 vezes o dobro da
+// área; a soma parcial é acumulada em 128 bits para não transbordar:
+inline int64_t area_dupla(const std::vector<vertice_exato>& V)
+{
+    __int128 soma = 0;
+    for(size_t i = 0; i < V.size(); i++)
+    {
+        const vertice_exato& a = V[i];
+        const vertice_exato& b = V[(i+1)%V.size()];
+        soma += __int128(a.dx)*b.dy - __int128(a.dy)*b.dx;
+    }
+    if(soma < 0)
+    {
+        soma = -soma;
+    }
+    return int64_t(soma/4);
+}
+
+// x        : número de vértices;
+// S        : solução de um problema (2, x)-Rainhas;
+// imprime  : se imprime a solução, o polígono e a área.
+// Retorna o dobro da área do polígono formado pelas rainhas da solução:
+inline int64_t area_dupla_de_solucao(unsigned int x, const unsigned int* S, bool imprime = false)
+{
+    // Vértices ordenados (memória reaproveitada entre as chamadas da linha de execução):
+    static thread_local std::vector<vertice_exato> V;
+    ordena_vertices_exatos(x, S, V);
+    int64_t A = area_dupla(V);
+    if(imprime)
+    {
+        // Imprime a solução:
+        imprime_vetor_de_naturais(x, S);
+        std::cout << " --> ";
+        std::cout << std::endl;
+        // Imprime cada vértice com o quadrado de seu raio e seu semiplano (que,
+        // com a ordem dos vértices, determinam sua posição angular):
+        for(const auto& v : V)
+        {
+            // Dobro do quadrado do raio (dx e dy têm a mesma paridade, então o
+            // quadrado do raio, (dx*dx + dy*dy)/4, é inteiro ou meio inteiro):
+            int64_t r2 = (v.dx*v.dx + v.dy*v.dy)/2;
+            std::cout << "(" << v.k << ", " << S[v.k] << ") <---> (r² = " << r2/2 << (r2%2 ? ".50" : ".00")
+                        << ", semiplano " << semiplano(v) << ")\n";
+        }
+        std::cout << "Área = " << A/2 << (A%2 ? ".50" : ".00");
+        std::cout << std::endl;
+    }
+    return A;
+}
+
+#endif
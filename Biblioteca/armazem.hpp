@@ -0,0 +1,217 @@
+#ifndef ARMAZEM_HPP
+#define ARMAZEM_HPP
+
+#include <cstdint> // uint64_t
+#include <vector> // vector
+
+#include "./sumidouro.hpp"
+
+// Número de palavras de 64 bits de um bloco do armazém (1 MB):
+#define PALAVRAS_POR_BLOCO (1u << 17)
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+// Retorna o número de bits necessário para uma coordenada, teto(log2(x)) (ao menos 1):
+inline unsigned int bits_por_coordenada(unsigned int x)
+{
+    unsigned int b = 1;
+    while(b < 32 && (uint64_t(1) << b) < x)
+    {
+        b++;
+    }
+    return b;
+}
+
+class ArmazemDeSolucoes;
+
+// Visão de uma solução guardada em um armazém (não copia a solução):
+class VisaoDeSolucao
+{
+    public:
+        // A: armazém; k: índice da solução.
+        VisaoDeSolucao(const ArmazemDeSolucoes* A, unsigned long long k)
+        {
+            this->A = A;
+            this->k = k;
+        }
+        // Número de coordenadas da solução:
+        unsigned int x() const;
+        // Coordenada da (i+1)-ésima rainha:
+        unsigned int operator[](unsigned int i) const;
+        // S: vetor de x naturais que recebe a solução desempacotada.
+        void desempacota(unsigned int* S) const;
+    private:
+        // Armazém de origem:
+        const ArmazemDeSolucoes* A;
+        // Índice da solução no armazém:
+        unsigned long long k;
+};
+
+// Conjunto de soluções empacotadas com teto(log2(x)) bits por coordenada,
+// em blocos contíguos grandes (cada bloco guarda um número inteiro de
+// soluções, então o acesso por índice é O(1)). Como é um destino de
+// soluções, pode ser preenchido diretamente por qualquer gerador:
+class ArmazemDeSolucoes : public Sumidouro
+{
+    public:
+        // x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+        ArmazemDeSolucoes(unsigned int x)
+        {
+            this->x = x;
+            this->b = bits_por_coordenada(x);
+            this->mascara = (uint64_t(1) << this->b) - 1;
+            this->bits_por_solucao = uint64_t(x)*this->b;
+            // Um bloco tem ao menos uma solução:
+            uint64_t palavras = (this->bits_por_solucao+63)/64;
+            this->palavras_por_bloco = palavras > PALAVRAS_POR_BLOCO ? palavras : PALAVRAS_POR_BLOCO;
+            this->solucoes_por_bloco = (this->palavras_por_bloco*64)/this->bits_por_solucao;
+            this->n = 0;
+        }
+
+        bool recebe(unsigned int, const unsigned int* S) override
+        {
+            this->acrescenta(S);
+            return true;
+        }
+
+        // S: solução de x coordenadas a acrescentar.
+        void acrescenta(const unsigned int* S)
+        {
+            // Posição da solução em seu bloco:
+            uint64_t j = this->n % this->solucoes_por_bloco;
+            // Se o bloco atual está cheio (ou não existe), cria um novo
+            // (com uma palavra extra para as leituras que atravessam o fim):
+            if(!j)
+            {
+                this->blocos.emplace_back(this->palavras_por_bloco+1, 0);
+            }
+            uint64_t* B = this->blocos.back().data();
+            // Posição em bits da primeira coordenada:
+            uint64_t p = j*this->bits_por_solucao;
+            // Para todas as coordenadas:
+            for(unsigned int i = 0; i < this->x; i++, p += this->b)
+            {
+                uint64_t w = p/64, s = p%64;
+                uint64_t v = uint64_t(S[i]) & this->mascara;
+                B[w] |= v << s;
+                // Se a coordenada atravessa a fronteira da palavra:
+                if(s + this->b > 64)
+                {
+                    B[w+1] |= v >> (64-s);
+                }
+            }
+            this->n++;
+        }
+
+        // k: índice da solução; i: índice da coordenada.
+        unsigned int coordenada(unsigned long long k, unsigned int i) const
+        {
+            const uint64_t* B = this->blocos[k/this->solucoes_por_bloco].data();
+            uint64_t p = (k%this->solucoes_por_bloco)*this->bits_por_solucao + uint64_t(i)*this->b;
+            uint64_t w = p/64, s = p%64;
+            uint64_t v = B[w] >> s;
+            // Se a coordenada atravessa a fronteira da palavra:
+            if(s + this->b > 64)
+            {
+                v |= B[w+1] << (64-s);
+            }
+            return unsigned(v & this->mascara);
+        }
+
+        // k: índice da solução; S: vetor de x naturais que recebe a solução.
+        void desempacota(unsigned long long k, unsigned int* S) const
+        {
+            for(unsigned int i = 0; i < this->x; i++)
+            {
+                S[i] = this->coordenada(k, i);
+            }
+        }
+
+        // s: destino das soluções.
+        // Reentrega todas as soluções guardadas, em ordem, a um destino
+        // (por exemplo, o mesmo analisador usado durante a geração).
+        // Retorna falso se o destino interrompeu a entrega:
+        bool percorre(Sumidouro& s) const
+        {
+            // Solução desempacotada:
+            std::vector<unsigned int> S(this->x);
+            for(unsigned long long k = 0; k < this->n; k++)
+            {
+                this->desempacota(k, S.data());
+                if(!s.recebe(this->x, S.data()))
+                {
+                    s.finaliza();
+                    return false;
+                }
+            }
+            s.finaliza();
+            return true;
+        }
+
+        // k: índice da solução.
+        VisaoDeSolucao operator[](unsigned long long k) const
+        {
+            return VisaoDeSolucao(this, k);
+        }
+
+        // Iterador sobre as visões das soluções:
+        class Iterador
+        {
+            public:
+                Iterador(const ArmazemDeSolucoes* A, unsigned long long k) : A(A), k(k) {}
+                VisaoDeSolucao operator*() const { return VisaoDeSolucao(this->A, this->k); }
+                Iterador& operator++() { this->k++; return *this; }
+                bool operator!=(const Iterador& o) const { return this->k != o.k; }
+            private:
+                const ArmazemDeSolucoes* A;
+                unsigned long long k;
+        };
+        Iterador begin() const { return Iterador(this, 0); }
+        Iterador end() const { return Iterador(this, this->n); }
+
+        // Número de soluções guardadas:
+        unsigned long long tamanho() const { return this->n; }
+        // Número de coordenadas por solução:
+        unsigned int coordenadas() const { return this->x; }
+        // Número de bits por coordenada:
+        unsigned int bits() const { return this->b; }
+        // Número de bytes alocados pelos blocos:
+        unsigned long long bytes() const
+        {
+            return (unsigned long long)this->blocos.size()*(this->palavras_por_bloco+1)*sizeof(uint64_t);
+        }
+
+    private:
+        // Número de coordenadas por solução:
+        unsigned int x;
+        // Número de bits por coordenada:
+        unsigned int b;
+        // Máscara dos b bits de uma coordenada:
+        uint64_t mascara;
+        // Número de bits por solução:
+        uint64_t bits_por_solucao;
+        // Número de palavras por bloco:
+        uint64_t palavras_por_bloco;
+        // Número de soluções por bloco:
+        uint64_t solucoes_por_bloco;
+        // Número de soluções guardadas:
+        unsigned long long n;
+        // Blocos de soluções empacotadas:
+        std::vector<std::vector<uint64_t>> blocos;
+};
+
+inline unsigned int VisaoDeSolucao::x() const
+{
+    return this->A->coordenadas();
+}
+
+inline unsigned int VisaoDeSolucao::operator[](unsigned int i) const
+{
+    return this->A->coordenada(this->k, i);
+}
+
+inline void VisaoDeSolucao::desempacota(unsigned int* S) const
+{
+    this->A->desempacota(this->k, S);
+}
+
+#endif
@@ -0,0 +1,649 @@
+#ifndef ARQUIVO_HPP
+#define ARQUIVO_HPP
+
+#include <cstdint> // uint32_t, uint64_t
+#include <cstdio> // FILE, fopen, fwrite, fseek, fclose
+#include <cstring> // memcmp, memcpy, memset
+#include <iostream> // cerr, endl
+#include <string> // string
+#include <vector> // vector
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap, msync
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close, ftruncate
+#endif
+
+#include "./armazem.hpp" // bits_por_coordenada
+#include "./sumidouro.hpp"
+
+// Identificação do formato:
+#define MAGICA_DE_ARQUIVO "RAINHAS"
+// Versão do formato:
+#define VERSAO_DE_ARQUIVO 1
+// Codificação dos registros: coordenadas empacotadas com teto(log2(x)) bits:
+#define CODIFICACAO_EMPACOTADA 1
+
+// Cabeçalho de um arquivo de soluções. O arquivo é formado pelo cabeçalho,
+// pelos registros (um fluxo de bits com x coordenadas de b bits por solução,
+// completado até a palavra de 64 bits seguinte mais uma palavra extra) e
+// pelo índice de prefixos (entradas de k coordenadas de 32 bits seguidas do
+// índice da primeira solução e do número de soluções com o prefixo):
+typedef struct CabecalhoDeArquivo
+{
+    char magica[8];                 // "RAINHAS".
+    uint32_t versao;                // versão do formato.
+    uint32_t codificacao;           // codificação dos registros.
+    uint32_t x;                     // número de possibilidades.
+    uint32_t b;                     // bits por coordenada.
+    uint64_t n;                     // número de soluções.
+    uint32_t k;                     // profundidade do índice de prefixos (0 se não há índice).
+    uint32_t completa;              // 1 se o arquivo tem todas as soluções do tabuleiro, 0 caso contrário.
+    uint64_t n_prefixos;            // número de entradas do índice.
+    uint64_t inicio_registros;      // posição (em bytes) dos registros.
+    uint64_t inicio_indice;         // posição (em bytes) do índice.
+} cabecalho_de_arquivo;
+
+// k: profundidade do índice.
+// Retorna o tamanho em bytes de uma entrada do índice:
+inline uint64_t bytes_por_entrada(uint32_t k)
+{
+    return uint64_t(k)*sizeof(uint32_t) + 2*sizeof(uint64_t);
+}
+
+// Escreve as soluções recebidas em um arquivo. As soluções devem chegar em
+// ordem lexicográfica não decrescente (como as entregam os geradores em
+// profundidade) para que o índice de prefixos seja válido; caso contrário,
+// o arquivo é escrito sem índice:
+class EscritorDeArquivo : public Sumidouro
+{
+    public:
+        // x: número de possibilidades; k: profundidade do índice de prefixos.
+        EscritorDeArquivo(unsigned int x, unsigned int k)
+        {
+            this->f = NULL;
+            this->k = k < x ? k : x;
+            std::memset(&this->C, 0, sizeof(this->C));
+            std::memcpy(this->C.magica, MAGICA_DE_ARQUIVO, sizeof(MAGICA_DE_ARQUIVO));
+            this->C.versao = VERSAO_DE_ARQUIVO;
+            this->C.codificacao = CODIFICACAO_EMPACOTADA;
+            this->C.x = x;
+            this->C.b = bits_por_coordenada(x);
+            this->C.k = this->k;
+            this->C.inicio_registros = sizeof(cabecalho_de_arquivo);
+            this->acumulador = 0;
+            this->n_bits = 0;
+            this->posicao = 0;
+            this->ordenado = true;
+            this->falhou = false;
+        }
+
+        ~EscritorDeArquivo()
+        {
+            // Se o arquivo ficou aberto, finaliza:
+            if(this->f)
+            {
+                this->finaliza();
+            }
+        }
+
+        // nome: caminho do arquivo.
+        // Retorna falso se não conseguiu criar o arquivo:
+        bool abre(const char* nome)
+        {
+            this->nome = nome;
+            this->falhou = false;
+            this->f = std::fopen(nome, "wb");
+            if(this->f == NULL)
+            {
+                std::cerr << "Erro ao criar o arquivo " << nome << "." << std::endl;
+                return false;
+            }
+            // Reserva o cabeçalho (reescrito ao fim):
+            if(std::fwrite(&this->C, sizeof(this->C), 1, this->f) != 1)
+            {
+                this->falhou = true;
+                this->descarta();
+                return false;
+            }
+            this->posicao = sizeof(this->C);
+            return true;
+        }
+
+        // Marca o arquivo como enumeração completa das soluções do tabuleiro (só
+        // deve ser chamada por quem entrega todas as soluções, e antes de finaliza):
+        void marca_completa()
+        {
+            this->C.completa = 1;
+        }
+
+        // Retorna verdadeiro se o arquivo foi finalizado sem erros de escrita:
+        bool gravou() const
+        {
+            return this->f == NULL && !this->falhou && !this->nome.empty();
+        }
+
+        bool recebe(unsigned int x, const unsigned int* S) override
+        {
+            // Se o arquivo não está aberto ou a escrita falhou, interrompe:
+            if(this->f == NULL || this->falhou)
+            {
+                return false;
+            }
+            // Atualiza o índice de prefixos:
+            this->indexa(S);
+            // Acrescenta as coordenadas ao fluxo de bits:
+            for(unsigned int i = 0; i < x; i++)
+            {
+                this->escreve_bits(S[i]);
+            }
+            this->C.n++;
+            return !this->falhou;
+        }
+
+        void finaliza() override
+        {
+            // Se o arquivo não está aberto, não há o que finalizar:
+            if(this->f == NULL)
+            {
+                return;
+            }
+            // Completa a última palavra e escreve a palavra extra:
+            if(this->n_bits)
+            {
+                this->escreve_palavra();
+            }
+            this->escreve_palavra();
+            // Se as soluções chegaram fora de ordem, descarta o índice:
+            if(!this->ordenado)
+            {
+                this->C.k = 0;
+                this->prefixos.clear();
+                this->primeiros.clear();
+                this->quantidades.clear();
+            }
+            // Escreve o índice após os registros (a posição é contada aqui, e não
+            // obtida com ftell, que usa long e não passa de 2 GB no Windows):
+            this->C.inicio_indice = this->posicao;
+            this->C.n_prefixos = this->primeiros.size();
+            for(uint64_t e = 0; e < this->C.n_prefixos && !this->falhou; e++)
+            {
+                this->falhou = std::fwrite(this->prefixos.data()+e*this->C.k, sizeof(uint32_t), this->C.k, this->f) != this->C.k
+                                || std::fwrite(&this->primeiros[e], sizeof(uint64_t), 1, this->f) != 1
+                                || std::fwrite(&this->quantidades[e], sizeof(uint64_t), 1, this->f) != 1;
+            }
+            // Reescreve o cabeçalho completo:
+            this->falhou = this->falhou || std::fseek(this->f, 0, SEEK_SET)
+                            || std::fwrite(&this->C, sizeof(this->C), 1, this->f) != 1;
+            // O fechamento descarrega o buffer, então também pode falhar:
+            this->falhou = (std::fclose(this->f) != 0) || this->falhou;
+            this->f = NULL;
+            if(this->falhou)
+            {
+                this->descarta();
+            }
+        }
+
+    private:
+        // Arquivo de saída e seu caminho:
+        FILE* f;
+        std::string nome;
+        // Se alguma escrita falhou (disco cheio, por exemplo):
+        bool falhou;
+        // Cabeçalho:
+        cabecalho_de_arquivo C;
+        // Profundidade do índice:
+        unsigned int k;
+        // Bits ainda não escritos:
+        uint64_t acumulador;
+        // Número de bits no acumulador:
+        unsigned int n_bits;
+        // Bytes escritos até o fim dos registros:
+        uint64_t posicao;
+        // Se as soluções chegaram em ordem:
+        bool ordenado;
+        // Entradas do índice (prefixos concatenados, primeira solução e quantidade):
+        std::vector<uint32_t> prefixos;
+        std::vector<uint64_t> primeiros;
+        std::vector<uint64_t> quantidades;
+
+        // Escreve o acumulador e o esvazia:
+        void escreve_palavra()
+        {
+            if(std::fwrite(&this->acumulador, sizeof(uint64_t), 1, this->f) != 1)
+            {
+                this->falhou = true;
+            }
+            this->posicao += sizeof(uint64_t);
+            this->acumulador = 0;
+            this->n_bits = 0;
+        }
+
+        // v: coordenada a acrescentar ao fluxo de bits.
+        void escreve_bits(uint64_t v)
+        {
+            this->acumulador |= v << this->n_bits;
+            // Se a coordenada completou a palavra:
+            if(this->n_bits + this->C.b >= 64)
+            {
+                unsigned int usados = 64 - this->n_bits;
+                this->escreve_palavra();
+                // Guarda os bits que sobraram:
+                if(usados < this->C.b)
+                {
+                    this->acumulador = v >> usados;
+                    this->n_bits = this->C.b - usados;
+                }
+            } else
+            {
+                this->n_bits += this->C.b;
+            }
+        }
+
+        // Relata a falha de escrita e fecha o arquivo incompleto. Ele não passa
+        // por válido no LeitorDeArquivo: ou o cabeçalho final não foi escrito,
+        // ou os registros e o índice que ele descreve não cabem no arquivo:
+        void descarta()
+        {
+            std::cerr << "Erro ao gravar o arquivo " << this->nome << "." << std::endl;
+            if(this->f)
+            {
+                std::fclose(this->f);
+                this->f = NULL;
+            }
+        }
+
+        // S: solução recebida.
+        void indexa(const unsigned int* S)
+        {
+            // Se não há índice ou já se perdeu a ordem:
+            if(!this->k || !this->ordenado)
+            {
+                return;
+            }
+            // Se há entrada anterior:
+            if(!this->primeiros.empty())
+            {
+                const uint32_t* U = this->prefixos.data() + this->prefixos.size() - this->k;
+                // Compara com o último prefixo:
+                for(unsigned int i = 0; i < this->k; i++)
+                {
+                    if(S[i] != U[i])
+                    {
+                        // Se o prefixo diminuiu, a ordem se perdeu:
+                        if(S[i] < U[i])
+                        {
+                            this->ordenado = false;
+                            return;
+                        }
+                        break;
+                    }
+                    // Se o prefixo é o mesmo, apenas conta a solução:
+                    if(i == this->k-1)
+                    {
+                        this->quantidades.back()++;
+                        return;
+                    }
+                }
+            }
+            // Cria uma nova entrada:
+            this->prefixos.insert(this->prefixos.end(), S, S+this->k);
+            this->primeiros.push_back(this->C.n);
+            this->quantidades.push_back(1);
+        }
+};
+
+// Cria um arquivo de soluções de tamanho conhecido (sem índice) e o mapeia
+// para escrita, para que os registros sejam preenchidos diretamente na
+// memória do arquivo, inclusive por várias linhas de execução em regiões
+// disjuntas de palavras:
+class EscritorMapeado
+{
+    public:
+        EscritorMapeado()
+        {
+            this->dados = NULL;
+            this->tamanho_em_bytes = 0;
+        }
+
+        ~EscritorMapeado()
+        {
+            this->fecha();
+        }
+
+        // nome : caminho do arquivo;
+        // x    : número de possibilidades;
+        // n    : número de soluções.
+        // Retorna falso se não conseguiu criar ou mapear o arquivo:
+        bool abre(const char* nome, unsigned int x, uint64_t n)
+        {
+            this->fecha();
+            // Cabeçalho:
+            cabecalho_de_arquivo C;
+            std::memset(&C, 0, sizeof(C));
+            std::memcpy(C.magica, MAGICA_DE_ARQUIVO, sizeof(MAGICA_DE_ARQUIVO));
+            C.versao = VERSAO_DE_ARQUIVO;
+            C.codificacao = CODIFICACAO_EMPACOTADA;
+            C.x = x;
+            C.b = bits_por_coordenada(x);
+            C.n = n;
+            C.inicio_registros = sizeof(cabecalho_de_arquivo);
+            // Registros completados até a palavra seguinte mais a palavra extra:
+            uint64_t palavras = (n*x*C.b + 63)/64 + 1;
+            C.inicio_indice = C.inicio_registros + palavras*sizeof(uint64_t);
+            this->tamanho_em_bytes = C.inicio_indice;
+#if defined(_WIN32)
+            HANDLE h = CreateFileA(nome, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+            if(h == INVALID_HANDLE_VALUE)
+            {
+                std::cerr << "Erro ao criar o arquivo " << nome << "." << std::endl;
+                return false;
+            }
+            HANDLE m = CreateFileMappingA(h, NULL, PAGE_READWRITE, DWORD(this->tamanho_em_bytes >> 32),
+                                            DWORD(this->tamanho_em_bytes & 0xFFFFFFFFu), NULL);
+            CloseHandle(h);
+            if(m == NULL)
+            {
+                std::cerr << "Erro ao mapear o arquivo " << nome << "." << std::endl;
+                return false;
+            }
+            this->dados = (unsigned char*)MapViewOfFile(m, FILE_MAP_WRITE, 0, 0, 0);
+            CloseHandle(m);
+#else
+            int fd = ::open(nome, O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if(fd < 0)
+            {
+                std::cerr << "Erro ao criar o arquivo " << nome << "." << std::endl;
+                return false;
+            }
+            // Estende o arquivo (com zeros) até o tamanho final:
+            if(ftruncate(fd, off_t(this->tamanho_em_bytes)) < 0)
+            {
+                ::close(fd);
+                std::cerr << "Erro ao estender o arquivo " << nome << "." << std::endl;
+                return false;
+            }
+            void* p = mmap(NULL, this->tamanho_em_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            this->dados = p == MAP_FAILED ? NULL : (unsigned char*)p;
+#endif
+            if(this->dados == NULL)
+            {
+                std::cerr << "Erro ao mapear o arquivo " << nome << "." << std::endl;
+                return false;
+            }
+            std::memcpy(this->dados, &C, sizeof(C));
+            return true;
+        }
+
+        // Palavras dos registros (inicialmente nulas), no formato de LeitorDeArquivo:
+        uint64_t* registros()
+        {
+            return (uint64_t*)(this->dados + sizeof(cabecalho_de_arquivo));
+        }
+
+        // Grava as alterações e desfaz o mapeamento:
+        void fecha()
+        {
+            if(this->dados)
+            {
+#if defined(_WIN32)
+                FlushViewOfFile(this->dados, 0);
+                UnmapViewOfFile(this->dados);
+#else
+                msync(this->dados, this->tamanho_em_bytes, MS_SYNC);
+                munmap(this->dados, this->tamanho_em_bytes);
+#endif
+            }
+            this->dados = NULL;
+        }
+
+    private:
+        // Início do mapeamento:
+        unsigned char* dados;
+        // Tamanho do arquivo:
+        uint64_t tamanho_em_bytes;
+};
+
+// Lê um arquivo de soluções mapeado em memória, sem interpretá-lo nem
+// copiá-lo: o acesso a uma solução ou a um prefixo é direto no mapeamento:
+class LeitorDeArquivo
+{
+    public:
+        LeitorDeArquivo()
+        {
+            this->dados = NULL;
+            this->tamanho_em_bytes = 0;
+            this->C = NULL;
+            this->registros = NULL;
+            this->indice = NULL;
+        }
+
+        ~LeitorDeArquivo()
+        {
+            this->fecha();
+        }
+
+        // nome: caminho do arquivo.
+        // Retorna falso se o arquivo não existe ou não é válido:
+        bool abre(const char* nome)
+        {
+            this->fecha();
+#if defined(_WIN32)
+            HANDLE h = CreateFileA(nome, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if(h == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+            LARGE_INTEGER t;
+            GetFileSizeEx(h, &t);
+            this->tamanho_em_bytes = uint64_t(t.QuadPart);
+            HANDLE m = this->tamanho_em_bytes ? CreateFileMappingA(h, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+            CloseHandle(h);
+            if(m == NULL)
+            {
+                return false;
+            }
+            this->dados = (const unsigned char*)MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(m);
+            if(this->dados == NULL)
+            {
+                return false;
+            }
+#else
+            int fd = ::open(nome, O_RDONLY);
+            if(fd < 0)
+            {
+                return false;
+            }
+            struct stat st;
+            if(fstat(fd, &st) < 0 || !st.st_size)
+            {
+                ::close(fd);
+                return false;
+            }
+            this->tamanho_em_bytes = uint64_t(st.st_size);
+            void* p = mmap(NULL, this->tamanho_em_bytes, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if(p == MAP_FAILED)
+            {
+                return false;
+            }
+            this->dados = (const unsigned char*)p;
+#endif
+            // Valida o cabeçalho:
+            this->C = (const cabecalho_de_arquivo*)this->dados;
+            if(!cabecalho_valido(this->C, this->tamanho_em_bytes))
+            {
+                std::cerr << "Erro. O arquivo " << nome << " não é um arquivo de soluções válido." << std::endl;
+                this->fecha();
+                return false;
+            }
+            this->registros = (const uint64_t*)(this->dados + this->C->inicio_registros);
+            this->indice = this->dados + this->C->inicio_indice;
+            this->mascara = (uint64_t(1) << this->C->b) - 1;
+            return true;
+        }
+
+        // Desfaz o mapeamento:
+        void fecha()
+        {
+            if(this->dados)
+            {
+#if defined(_WIN32)
+                UnmapViewOfFile(this->dados);
+#else
+                munmap((void*)this->dados, this->tamanho_em_bytes);
+#endif
+            }
+            this->dados = NULL;
+            this->C = NULL;
+        }
+
+        // Número de possibilidades:
+        unsigned int x() const { return this->C->x; }
+        // Número de soluções:
+        unsigned long long tamanho() const { return this->C->n; }
+        // Profundidade do índice de prefixos:
+        unsigned int profundidade_do_indice() const { return this->C->k; }
+        // Se o arquivo tem todas as soluções do tabuleiro:
+        bool completa() const { return this->C->completa == 1; }
+        // Número de entradas do índice de prefixos:
+        unsigned long long prefixos() const { return this->C->n_prefixos; }
+
+        // k: índice da solução; i: índice da coordenada.
+        unsigned int coordenada(unsigned long long k, unsigned int i) const
+        {
+            uint64_t p = (uint64_t(k)*this->C->x + i)*this->C->b;
+            uint64_t w = p/64, s = p%64;
+            uint64_t v = this->registros[w] >> s;
+            // Se a coordenada atravessa a fronteira da palavra:
+            if(s + this->C->b > 64)
+            {
+                v |= this->registros[w+1] << (64-s);
+            }
+            return unsigned(v & this->mascara);
+        }
+
+        // k: índice da solução; S: vetor de x naturais que recebe a solução.
+        void desempacota(unsigned long long k, unsigned int* S) const
+        {
+            for(unsigned int i = 0; i < this->C->x; i++)
+            {
+                S[i] = this->coordenada(k, i);
+            }
+        }
+
+        // e: índice da entrada do índice de prefixos;
+        // P: vetor de k naturais que recebe o prefixo;
+        // primeiro, quantidade: intervalo de soluções com o prefixo.
+        void entrada(unsigned long long e, unsigned int* P, unsigned long long* primeiro, unsigned long long* quantidade) const
+        {
+            const unsigned char* E = this->indice + e*bytes_por_entrada(this->C->k);
+            uint64_t v;
+            for(unsigned int i = 0; i < this->C->k; i++)
+            {
+                uint32_t c;
+                std::memcpy(&c, E + i*sizeof(uint32_t), sizeof(uint32_t));
+                P[i] = c;
+            }
+            std::memcpy(&v, E + this->C->k*sizeof(uint32_t), sizeof(uint64_t));
+            *primeiro = v;
+            std::memcpy(&v, E + this->C->k*sizeof(uint32_t) + sizeof(uint64_t), sizeof(uint64_t));
+            *quantidade = v;
+        }
+
+        // P: prefixo de k coordenadas (k = profundidade do índice);
+        // primeiro, quantidade: intervalo de soluções com o prefixo.
+        // Retorna falso se não há soluções com o prefixo (busca binária no índice):
+        bool busca_prefixo(const unsigned int* P, unsigned long long* primeiro, unsigned long long* quantidade) const
+        {
+            std::vector<unsigned int> Q(this->C->k);
+            unsigned long long a = 0, b = this->C->n_prefixos;
+            while(a < b)
+            {
+                unsigned long long m = (a+b)/2;
+                this->entrada(m, Q.data(), primeiro, quantidade);
+                // Compara o prefixo da entrada com o procurado:
+                int c = 0;
+                for(unsigned int i = 0; i < this->C->k && !c; i++)
+                {
+                    c = Q[i] < P[i] ? -1 : (Q[i] > P[i] ? 1 : 0);
+                }
+                if(!c)
+                {
+                    return true;
+                }
+                if(c < 0) a = m+1; else b = m;
+            }
+            *primeiro = *quantidade = 0;
+            return false;
+        }
+
+        // s: destino das soluções;
+        // primeiro, quantidade: intervalo de soluções a entregar.
+        // Retorna falso se o destino interrompeu a entrega:
+        bool percorre(Sumidouro& s, unsigned long long primeiro, unsigned long long quantidade) const
+        {
+            std::vector<unsigned int> S(this->C->x);
+            for(unsigned long long k = primeiro; k < primeiro+quantidade && k < this->C->n; k++)
+            {
+                this->desempacota(k, S.data());
+                if(!s.recebe(this->C->x, S.data()))
+                {
+                    s.finaliza();
+                    return false;
+                }
+            }
+            s.finaliza();
+            return true;
+        }
+
+    private:
+        // Arquivo mapeado:
+        const unsigned char* dados;
+        // Tamanho do arquivo:
+        uint64_t tamanho_em_bytes;
+        // Cabeçalho:
+        const cabecalho_de_arquivo* C;
+        // Início dos registros:
+        const uint64_t* registros;
+        // Início do índice:
+        const unsigned char* indice;
+        // Máscara dos b bits de uma coordenada:
+        uint64_t mascara;
+
+        // C: cabeçalho mapeado; tamanho_em_bytes: tamanho do arquivo.
+        // Retorna verdadeiro se o cabeçalho é coerente e os registros e o índice
+        // que ele descreve cabem no arquivo (as contas são feitas em 128 bits,
+        // então um cabeçalho corrompido não as faz transbordar):
+        static bool cabecalho_valido(const cabecalho_de_arquivo* C, uint64_t tamanho_em_bytes)
+        {
+            if(tamanho_em_bytes < sizeof(cabecalho_de_arquivo)
+                || std::memcmp(C->magica, MAGICA_DE_ARQUIVO, sizeof(MAGICA_DE_ARQUIVO))
+                || C->versao != VERSAO_DE_ARQUIVO
+                || C->codificacao != CODIFICACAO_EMPACOTADA
+                || !C->x || C->b < 1 || C->b > 32 || C->b != bits_por_coordenada(C->x)
+                || C->k > C->x
+                || C->completa > 1
+                || C->inicio_registros != sizeof(cabecalho_de_arquivo)
+                || C->inicio_indice < C->inicio_registros)
+            {
+                return false;
+            }
+            // Registros completados até a palavra seguinte mais a palavra extra:
+            unsigned __int128 palavras = ((unsigned __int128)C->n*C->x*C->b + 63)/64 + 1;
+            if((unsigned __int128)C->inicio_registros + palavras*sizeof(uint64_t) > C->inicio_indice)
+            {
+                return false;
+            }
+            // Índice após os registros:
+            return (unsigned __int128)C->inicio_indice + (unsigned __int128)C->n_prefixos*bytes_por_entrada(C->k)
+                    <= tamanho_em_bytes;
+        }
+};
+
+#endif
@@ -0,0 +1,424 @@
+#ifndef COBERTURA_EXATA_HPP
+#define COBERTURA_EXATA_HPP
+
+#include <iostream> // cerr, endl
+#include <vector> // vector
+
+#include "./sumidouro.hpp"
+
+// Problema de cobertura exata resolvido por links dançantes (DLX). Os nós
+// ficam em vetores paralelos (índices no lugar de ponteiros), então a
+// matriz é contígua. O nó 0 é a raiz, os nós 1..n_colunas são os cabeçalhos
+// das colunas e os demais são os 1s das linhas. As colunas primárias devem
+// ser cobertas exatamente uma vez; as secundárias, no máximo uma vez:
+class CoberturaExata
+{
+    public:
+        // n_primarias  : número de colunas primárias (colunas 0..n_primarias-1);
+        // n_secundarias: número de colunas secundárias (as seguintes).
+        CoberturaExata(unsigned int n_primarias, unsigned int n_secundarias)
+        {
+            unsigned int n = n_primarias + n_secundarias;
+            this->n_primarias = n_primarias;
+            this->n_colunas = n;
+            // Raiz e cabeçalhos:
+            for(unsigned int c = 0; c <= n; c++)
+            {
+                this->acrescenta_no(c, c);
+                // Cada cabeçalho começa como uma lista vertical vazia:
+                this->U[c] = this->D[c] = c;
+            }
+            // Lista horizontal da raiz com as colunas primárias:
+            for(unsigned int c = 0; c <= n_primarias; c++)
+            {
+                this->R[c] = c < n_primarias ? c+1 : 0;
+                this->L[c] = c ? c-1 : n_primarias;
+            }
+            // As colunas secundárias ficam fora da lista (ligadas a si mesmas):
+            for(unsigned int c = n_primarias+1; c <= n; c++)
+            {
+                this->L[c] = this->R[c] = c;
+            }
+            this->S.assign(n+1, 0);
+            this->coberta.assign(n+1, 0);
+        }
+
+        // colunas: índices das colunas da linha (0..n_colunas-1).
+        // Retorna o índice da linha acrescentada:
+        unsigned int acrescenta_linha(const std::vector<unsigned int>& colunas)
+        {
+            unsigned int linha = this->inicio.size();
+            unsigned int primeiro = this->L.size();
+            this->inicio.push_back(primeiro);
+            for(size_t k = 0; k < colunas.size(); k++)
+            {
+                unsigned int c = colunas[k]+1;
+                unsigned int no = this->acrescenta_no(c, linha);
+                // Insere no fim da lista vertical da coluna:
+                this->U[no] = this->U[c];
+                this->D[no] = c;
+                this->D[this->U[c]] = no;
+                this->U[c] = no;
+                this->S[c]++;
+                // Insere no fim da lista horizontal da linha:
+                this->L[no] = k ? no-1 : no;
+                this->R[no] = primeiro;
+                this->R[this->L[no]] = no;
+                this->L[primeiro] = no;
+            }
+            return linha;
+        }
+
+        // linha: índice de linha.
+        // Fixa a linha na solução (antes da busca). Retorna falso se a
+        // linha conflita com outra já fixada:
+        bool fixa(unsigned int linha)
+        {
+            unsigned int r = this->inicio[linha];
+            // Se alguma coluna da linha já foi coberta:
+            unsigned int j = r;
+            do
+            {
+                if(this->coberta[this->C[j]])
+                {
+                    return false;
+                }
+                j = this->R[j];
+            } while(j != r);
+            // Cobre as colunas da linha:
+            do
+            {
+                this->coberta[this->C[j]] = 1;
+                this->cobre(this->C[j]);
+                j = this->R[j];
+            } while(j != r);
+            this->fixas.push_back(linha);
+            return true;
+        }
+
+        // f: função chamada com (linhas da solução, número de linhas), que
+        //    retorna falso para interromper a busca.
+        // Algoritmo X iterativo (coluna primária de menor tamanho primeiro).
+        // Retorna falso se f interrompeu a busca:
+        template<typename F>
+        bool resolve(F f)
+        {
+            // Linhas da solução parcial (as fixas primeiro):
+            std::vector<unsigned int> linhas(this->fixas);
+            unsigned int base = linhas.size();
+            linhas.resize(base + this->n_primarias);
+            // Nós escolhidos em cada nível:
+            std::vector<unsigned int> O(this->n_primarias+1);
+            // Nível atual:
+            unsigned int nivel = 0;
+            // Se avança (escolhe uma coluna) ou retrocede (troca a linha do nível anterior):
+            bool avanca = true;
+            // Se a busca continua:
+            bool continua = true;
+            unsigned int c = 0, r = 0;
+
+            while(true)
+            {
+                if(avanca)
+                {
+                    // Se todas as colunas primárias estão cobertas:
+                    if(this->R[0] == 0)
+                    {
+                        // Entrega a solução:
+                        for(unsigned int k = 0; k < nivel; k++)
+                        {
+                            linhas[base+k] = this->linha_do_no[O[k]];
+                        }
+                        continua = f(linhas.data(), base+nivel);
+                        avanca = false;
+                        // Se interrompeu, retrocede todos os níveis sem testar novas linhas:
+                        if(!continua)
+                        {
+                            break;
+                        }
+                        continue;
+                    }
+                    c = this->escolhe_coluna();
+                    // Se a coluna não pode ser coberta, retrocede:
+                    if(!this->S[c])
+                    {
+                        avanca = false;
+                        continue;
+                    }
+                    this->cobre(c);
+                    r = this->D[c];
+                } else
+                {
+                    // Se não há nível anterior, terminou a busca:
+                    if(!nivel)
+                    {
+                        break;
+                    }
+                    // Desfaz a linha do nível anterior e passa para a seguinte:
+                    nivel--;
+                    r = O[nivel];
+                    c = this->C[r];
+                    for(unsigned int j = this->L[r]; j != r; j = this->L[j])
+                    {
+                        this->descobre(this->C[j]);
+                    }
+                    r = this->D[r];
+                }
+                // Se esgotou as linhas da coluna:
+                if(r == c)
+                {
+                    this->descobre(c);
+                    avanca = false;
+                    continue;
+                }
+                // Escolhe a linha e cobre suas demais colunas:
+                O[nivel++] = r;
+                for(unsigned int j = this->R[r]; j != r; j = this->R[j])
+                {
+                    this->cobre(this->C[j]);
+                }
+                avanca = true;
+            }
+
+            // Se interrompeu, restaura a matriz:
+            while(nivel)
+            {
+                nivel--;
+                r = O[nivel];
+                for(unsigned int j = this->L[r]; j != r; j = this->L[j])
+                {
+                    this->descobre(this->C[j]);
+                }
+                this->descobre(this->C[r]);
+            }
+            return continua;
+        }
+
+        // Retorna o número de soluções:
+        unsigned long long conta()
+        {
+            unsigned long long n = 0;
+            this->resolve([&](const unsigned int*, unsigned int)
+            {
+                n++;
+                return true;
+            });
+            return n;
+        }
+
+    private:
+        // Ligações à esquerda, à direita, acima e abaixo de cada nó:
+        std::vector<unsigned int> L, R, U, D;
+        // Cabeçalho da coluna de cada nó:
+        std::vector<unsigned int> C;
+        // Linha de cada nó:
+        std::vector<unsigned int> linha_do_no;
+        // Número de nós de cada coluna:
+        std::vector<unsigned int> S;
+        // Se a coluna foi coberta por uma linha fixa:
+        std::vector<unsigned char> coberta;
+        // Primeiro nó de cada linha:
+        std::vector<unsigned int> inicio;
+        // Linhas fixas:
+        std::vector<unsigned int> fixas;
+        // Número de colunas primárias e total:
+        unsigned int n_primarias;
+        unsigned int n_colunas;
+
+        // c: cabeçalho; linha: linha do nó.
+        unsigned int acrescenta_no(unsigned int c, unsigned int linha)
+        {
+            this->L.push_back(0);
+            this->R.push_back(0);
+            this->U.push_back(0);
+            this->D.push_back(0);
+            this->C.push_back(c);
+            this->linha_do_no.push_back(linha);
+            return this->L.size()-1;
+        }
+
+        // Retorna a coluna primária com menos nós:
+        unsigned int escolhe_coluna() const
+        {
+            unsigned int melhor = this->R[0];
+            for(unsigned int c = this->R[melhor]; c != 0; c = this->R[c])
+            {
+                if(this->S[c] < this->S[melhor])
+                {
+                    melhor = c;
+                }
+            }
+            return melhor;
+        }
+
+        // c: cabeçalho da coluna a cobrir (retira a coluna e as linhas que a usam).
+        void cobre(unsigned int c)
+        {
+            this->R[this->L[c]] = this->R[c];
+            this->L[this->R[c]] = this->L[c];
+            for(unsigned int i = this->D[c]; i != c; i = this->D[i])
+            {
+                for(unsigned int j = this->R[i]; j != i; j = this->R[j])
+                {
+                    this->U[this->D[j]] = this->U[j];
+                    this->D[this->U[j]] = this->D[j];
+                    this->S[this->C[j]]--;
+                }
+            }
+        }
+
+        // c: cabeçalho da coluna a descobrir (na ordem inversa da cobertura).
+        void descobre(unsigned int c)
+        {
+            for(unsigned int i = this->U[c]; i != c; i = this->U[i])
+            {
+                for(unsigned int j = this->L[i]; j != i; j = this->L[j])
+                {
+                    this->S[this->C[j]]++;
+                    this->U[this->D[j]] = j;
+                    this->D[this->U[j]] = j;
+                }
+            }
+            this->R[this->L[c]] = c;
+            this->L[this->R[c]] = c;
+        }
+};
+
+// Casa de um (2, x)-tabuleiro:
+typedef struct Casa
+{
+    unsigned int i; // índice de linha (posição da rainha).
+    unsigned int v; // índice de coluna (coordenada da rainha).
+} casa;
+
+// Cobertura exata do (2, x)-tabuleiro: as linhas e colunas do tabuleiro
+// são colunas primárias e as diagonais e antidiagonais são secundárias;
+// cada casa não bloqueada é uma linha da matriz. As soluções não saem em
+// ordem lexicográfica (a busca escolhe antes a restrição com menos opções):
+class CoberturaDeRainhas
+{
+    public:
+        // x         : número de possibilidades de valor de coordenada de dimensão de um espaço;
+        // bloqueadas: casas proibidas.
+        CoberturaDeRainhas(unsigned int x, const std::vector<casa>& bloqueadas = {})
+            : M(2*x, 2*(2*x-1)), linha(x*x, 0)
+        {
+            this->x = x;
+            this->possivel = true;
+            // Marca as casas bloqueadas (linha x*x):
+            for(auto b : bloqueadas)
+            {
+                if(b.i < x && b.v < x)
+                {
+                    this->linha[b.i*x + b.v] = x*x;
+                }
+            }
+            // Colunas de uma casa: linha, coluna, diagonal e antidiagonal:
+            for(unsigned int i = 0; i < x; i++)
+            {
+                for(unsigned int v = 0; v < x; v++)
+                {
+                    if(this->linha[i*x + v] == x*x)
+                    {
+                        continue;
+                    }
+                    this->linha[i*x + v] = this->M.acrescenta_linha({i, x+v, 2*x + i+v, 2*x + (2*x-1) + (x-1) + i-v});
+                    this->casa_da_linha.push_back({i, v});
+                }
+            }
+        }
+
+        // f: casa de uma rainha posicionada previamente.
+        // Retorna falso (e não há mais soluções) se a casa está fora do
+        // tabuleiro, é bloqueada ou é atacada por outra rainha fixada:
+        bool fixa(casa f)
+        {
+            if(f.i >= this->x || f.v >= this->x || this->linha[f.i*this->x + f.v] == this->x*this->x
+                || !this->M.fixa(this->linha[f.i*this->x + f.v]))
+            {
+                this->possivel = false;
+            }
+            return this->possivel;
+        }
+
+        // s: destino das soluções.
+        // Retorna falso se o destino interrompeu a geração:
+        bool gera(Sumidouro& s)
+        {
+            bool continua = true;
+            if(this->possivel)
+            {
+                // Solução:
+                std::vector<unsigned int> S(this->x);
+                continua = this->M.resolve([&](const unsigned int* linhas, unsigned int n)
+                {
+                    for(unsigned int k = 0; k < n; k++)
+                    {
+                        S[this->casa_da_linha[linhas[k]].i] = this->casa_da_linha[linhas[k]].v;
+                    }
+                    return s.recebe(this->x, S.data());
+                });
+            }
+            s.finaliza();
+            return continua;
+        }
+
+        // Retorna o número de soluções:
+        unsigned long long conta()
+        {
+            return this->possivel ? this->M.conta() : 0;
+        }
+
+    private:
+        // Número de possibilidades:
+        unsigned int x;
+        // Matriz de cobertura:
+        CoberturaExata M;
+        // Linha da matriz de cada casa (x*x se bloqueada):
+        std::vector<unsigned int> linha;
+        // Casa de cada linha da matriz:
+        std::vector<casa> casa_da_linha;
+        // Se as rainhas fixadas não se atacam:
+        bool possivel;
+};
+
+// x         : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// s         : destino das soluções;
+// fixas     : rainhas posicionadas previamente;
+// bloqueadas: casas proibidas.
+// Gerador por cobertura exata. Retorna falso se o destino interrompeu a geração:
+inline bool gera_solucoes_por_cobertura(unsigned int x, Sumidouro& s, const std::vector<casa>& fixas = {},
+                                            const std::vector<casa>& bloqueadas = {})
+{
+    if(!x)
+    {
+        std::cerr << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        s.finaliza();
+        return true;
+    }
+    CoberturaDeRainhas C(x, bloqueadas);
+    for(auto f : fixas)
+    {
+        C.fixa(f);
+    }
+    return C.gera(s);
+}
+
+// x, fixas, bloqueadas: como em gera_solucoes_por_cobertura.
+// Retorna o número de soluções:
+inline unsigned long long conta_solucoes_por_cobertura(unsigned int x, const std::vector<casa>& fixas = {},
+                                                            const std::vector<casa>& bloqueadas = {})
+{
+    if(!x)
+    {
+        return 0;
+    }
+    CoberturaDeRainhas C(x, bloqueadas);
+    for(auto f : fixas)
+    {
+        C.fixa(f);
+    }
+    return C.conta();
+}
+
+#endif
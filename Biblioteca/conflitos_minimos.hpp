@@ -0,0 +1,233 @@
+#ifndef CONFLITOS_MINIMOS_HPP
+#define CONFLITOS_MINIMOS_HPP
+
+#include <algorithm> // fill, swap
+#include <atomic> // atomic
+#include <cstdint> // uint64_t
+#include <mutex> // mutex, lock_guard
+#include <random> // mt19937_64
+#include <set> // set
+#include <thread> // thread, hardware_concurrency
+#include <vector> // vector
+
+#include "./sumidouro.hpp"
+
+// Cadeias consecutivas sem solução nova após as quais uma linha de execução
+// desiste (para x pequeno, em que as soluções se esgotam ou não existem):
+#define CADEIAS_SEM_NOVIDADE_MAX 1000
+
+// Cadeia de busca local por conflitos mínimos. A solução é mantida como uma
+// permutação (cada coluna tem exatamente uma rainha, então os contadores de
+// coluna são constantes), e as rainhas são trocadas de coluna duas a duas.
+// Os contadores de rainhas por diagonal e antidiagonal e o número de pares
+// em conflito são atualizados em O(1) a cada troca:
+class CadeiaDeConflitos
+{
+    public:
+        // x      : número de possibilidades;
+        // semente: semente do gerador aleatório da cadeia.
+        CadeiaDeConflitos(unsigned int x, uint64_t semente) : gerador(semente)
+        {
+            this->x = x;
+            this->S.resize(x);
+            this->d.resize(x ? 2*x-1 : 0);
+            this->a.resize(x ? 2*x-1 : 0);
+        }
+
+        // Solução atual:
+        const unsigned int* solucao() const
+        {
+            return this->S.data();
+        }
+
+        // Reinicia a cadeia: sorteia para cada posição uma das colunas
+        // restantes até achar uma sem conflitos (com no máximo 3x sorteios
+        // no total); as demais rainhas ficam nas colunas
+        // restantes, com os conflitos que houver:
+        void reinicia()
+        {
+            unsigned int x = this->x;
+            for(unsigned int i = 0; i < x; i++)
+            {
+                this->S[i] = i;
+            }
+            std::fill(this->d.begin(), this->d.end(), 0);
+            std::fill(this->a.begin(), this->a.end(), 0);
+            this->pares = 0;
+
+            unsigned int i = 0;
+            unsigned long long tentativas = 0;
+            for(; i < x && tentativas < 3ull*x; tentativas++)
+            {
+                // Sorteia uma das colunas restantes para a posição i:
+                unsigned int m = i + this->sorteia(x-i);
+                std::swap(this->S[i], this->S[m]);
+                // Se a casa não está atacada, fixa a rainha:
+                if(!this->d[this->S[i]+i] && !this->a[this->S[i]+x-1-i])
+                {
+                    this->coloca(i);
+                    i++;
+                }
+            }
+            // Posiciona as demais rainhas nas colunas restantes:
+            for(; i < x; i++)
+            {
+                this->coloca(i);
+            }
+        }
+
+        // passos: número máximo de trocas tentadas.
+        // Repara a solução trocando cada rainha em conflito com rainhas
+        // sorteadas e aceitando as trocas que reduzem os conflitos.
+        // Retorna verdadeiro se a solução ficou sem conflitos:
+        bool repara(unsigned long long passos)
+        {
+            unsigned int x = this->x;
+            while(this->pares && passos)
+            {
+                // Para todas as posições:
+                for(unsigned int i = 0; i < x && this->pares && passos; i++)
+                {
+                    // Se a rainha não está em conflito:
+                    if(!this->em_conflito(i))
+                    {
+                        continue;
+                    }
+                    // Tenta trocas até reduzir os conflitos ou esgotar os passos:
+                    while(passos)
+                    {
+                        passos--;
+                        unsigned int j = this->sorteia(x);
+                        if(j == i)
+                        {
+                            continue;
+                        }
+                        unsigned long long antes = this->pares;
+                        this->troca(i, j);
+                        // Se reduziu, aceita; senão, desfaz:
+                        if(this->pares < antes)
+                        {
+                            break;
+                        }
+                        this->troca(i, j);
+                    }
+                }
+            }
+            return !this->pares;
+        }
+
+    private:
+        // Número de possibilidades:
+        unsigned int x;
+        // Coluna da rainha de cada posição:
+        std::vector<unsigned int> S;
+        // Rainhas em cada diagonal (v+i) e antidiagonal (v+x-1-i):
+        std::vector<unsigned int> d, a;
+        // Número de pares de rainhas que se atacam:
+        unsigned long long pares;
+        // Gerador aleatório da cadeia:
+        std::mt19937_64 gerador;
+
+        // Sorteia um inteiro em [0, n):
+        unsigned int sorteia(unsigned int n)
+        {
+            return (unsigned int)(this->gerador() % n);
+        }
+        // Se a rainha da posição i divide diagonal ou antidiagonal com outra:
+        bool em_conflito(unsigned int i) const
+        {
+            return this->d[this->S[i]+i] > 1 || this->a[this->S[i]+this->x-1-i] > 1;
+        }
+        // Acrescenta a rainha da posição i aos contadores:
+        void coloca(unsigned int i)
+        {
+            this->pares += this->d[this->S[i]+i]++;
+            this->pares += this->a[this->S[i]+this->x-1-i]++;
+        }
+        // Retira a rainha da posição i dos contadores:
+        void retira(unsigned int i)
+        {
+            this->pares -= --this->d[this->S[i]+i];
+            this->pares -= --this->a[this->S[i]+this->x-1-i];
+        }
+        // Troca as colunas das rainhas das posições i e j:
+        void troca(unsigned int i, unsigned int j)
+        {
+            this->retira(i);
+            this->retira(j);
+            std::swap(this->S[i], this->S[j]);
+            this->coloca(i);
+            this->coloca(j);
+        }
+};
+
+// x      : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_des  : número de soluções distintas desejadas;
+// n_t    : número de linhas de execução (0 para o número de núcleos);
+// semente: semente da primeira cadeia (a cadeia t usa semente+t);
+// s      : destino das soluções (chamado por uma linha de execução por vez).
+// Busca por conflitos mínimos com reinícios aleatórios: cada linha de execução
+// roda uma cadeia independente, reiniciada quando esgota os passos de reparo,
+// e as soluções encontradas são deduplicadas em um conjunto compartilhado antes
+// de serem entregues. Para ao atingir n_des soluções distintas, quando o destino
+// pede ou quando todas as linhas de execução desistem. Retorna o número de
+// soluções distintas entregues:
+inline unsigned long long gera_solucoes_por_reparo(unsigned int x, unsigned long long n_des, unsigned int n_t,
+                                                    uint64_t semente, Sumidouro& s)
+{
+    if(!n_t)
+    {
+        n_t = std::thread::hardware_concurrency();
+        n_t = n_t ? n_t : 1;
+    }
+    // Soluções distintas já entregues e exclusão mútua sobre elas e o destino:
+    std::set<std::vector<unsigned int>> vistas;
+    std::mutex trava;
+    // Sinal de parada para todas as cadeias:
+    std::atomic<bool> parar(!x || !n_des);
+
+    auto trabalho = [&](unsigned int t)
+    {
+        CadeiaDeConflitos C(x, semente + t);
+        // Passos de reparo por reinício (as soluções aparecem em cerca de x passos):
+        unsigned long long passos = 64ull*x + 1024;
+        unsigned int sem_novidade = 0;
+        while(!parar.load(std::memory_order_relaxed) && sem_novidade < CADEIAS_SEM_NOVIDADE_MAX)
+        {
+            C.reinicia();
+            if(!C.repara(passos))
+            {
+                sem_novidade++;
+                continue;
+            }
+            std::vector<unsigned int> R(C.solucao(), C.solucao() + x);
+            std::lock_guard<std::mutex> guarda(trava);
+            // Se outra linha de execução já encerrou ou a solução é repetida:
+            if(parar.load(std::memory_order_relaxed) || !vistas.insert(R).second)
+            {
+                sem_novidade++;
+                continue;
+            }
+            sem_novidade = 0;
+            // Entrega a solução e para se o destino pede ou se atingiu o desejado:
+            if(!s.recebe(x, R.data()) || vistas.size() == n_des)
+            {
+                parar = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> trabalhadores;
+    for(unsigned int t = 0; t < n_t; t++)
+    {
+        trabalhadores.emplace_back(trabalho, t);
+    }
+    for(auto& t : trabalhadores)
+    {
+        t.join();
+    }
+    s.finaliza();
+    return vistas.size();
+}
+
+#endif
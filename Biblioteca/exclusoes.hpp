@@ -0,0 +1,182 @@
+#ifndef EXCLUSOES_HPP
+#define EXCLUSOES_HPP
+
+#include <iostream> // cout, endl
+#include <queue> // queue
+#include <string> // string
+#include <vector> // vector
+
+#include "./analisadores.hpp"
+
+inline void desenfilera_exclusao(unsigned int i, std::string str1, std::string str2,
+                            std::vector<std::queue<bool>>& conf)
+{
+    // Se exclusão efetiva:
+    if(conf[i].front())
+    {
+        // Imprime a primeira string:
+        std::cout << str1;
+    } else
+    { // Senão:
+        // Imprime a segunda string:
+        std::cout << str2;
+    }
+    // Retira exclusão da fila:
+    conf[i].pop();
+}
+
+inline void imprime_os_padroes_das_exclusoes(unsigned int x, std::vector<std::queue<bool>>& conf)
+{
+    // Abre o vetor de padrões:
+    std::cout << "[";
+
+    // Para todos os padrões exceto o último:
+    for(unsigned int i = 0; i < x-1; i++)
+    {
+        desenfilera_exclusao(i, "O, ", "-, ", conf);
+    }
+
+    // Se tem padrão:
+    if(x)
+    {
+        desenfilera_exclusao(x-1, "O", "-", conf);
+        // Imprime quebra de linha:
+        std::cout << std::endl;
+    }
+
+    // Para todas as exclusões de um padrão exceto a primeira e a última:
+    for(unsigned int k = 1; int(k) < int(2*(x-1)-1); k++)
+    {
+        // Para todos os padrões exceto o último:
+        for(unsigned int i = 0; i < x-1; i++)
+        {
+            desenfilera_exclusao(i, " O,", " -,", conf);
+        }
+
+        desenfilera_exclusao(x-1, " O", " -", conf);
+        // Imprime quebra de linha:
+        std::cout << std::endl;
+    }
+
+    // Para todos os padrões exceto o último:
+    for(unsigned int i = 0; i < x-1; i++)
+    {
+        desenfilera_exclusao(i, " O,", " -,", conf);
+    }
+
+    // Se tem padrão:
+    if(x)
+    {
+        desenfilera_exclusao(x-1, " O", " -", conf);
+    }
+
+    // Fecha o vetor de padrões:
+    std::cout << "]";
+}
+
+inline void valida_exclusao_a_direita_do_limite_a_esquerda(unsigned int k, unsigned int i, unsigned int lim,
+        const unsigned int* S, std::vector<unsigned int>& cont, std::vector<std::queue<bool>>& conf, unsigned int* total)
+{
+    // Se gera exclusão a esquerda do limite a esquerda:
+    if(S[i] < lim)
+    {
+        // Não conta a exclusão:
+        conf[k].push(false);
+    } else
+    { // Senão:
+        // Conta a exclusão:
+        cont[k]++;
+        conf[k].push(true);
+        (*total)++;
+    }
+}
+
+inline void valida_exclusao_a_esquerda_do_limite_a_direita(unsigned int k, unsigned int i, unsigned int lim,
+        const unsigned int* S, std::vector<unsigned int>& cont, std::vector<std::queue<bool>>& conf, unsigned int* total)
+{
+    // Se gera exclusão a direita do limite a direita:
+    if(S[i] > lim)
+    {
+        // Não conta a exclusão:
+        conf[k].push(false);
+    } else
+    {
+        // Conta a exclusão:
+        cont[k]++;
+        conf[k].push(true);
+        (*total)++;
+    }
+}
+
+// x        : número de possibilidades;
+// S        : solução de um problema (2, x)-Rainhas;
+// imprime  : se imprime a solução, as exclusões por rainha e seus padrões.
+// Retorna a soma das exclusões efetivas (restrições de coordenadas
+// pertencentes ao conjunto de possibilidades):
+inline unsigned int conta_exclusoes(unsigned int x, const unsigned int* S, bool imprime = false)
+{
+    // Contador de exclusões de possibilidades:
+    std::vector<unsigned int> cont(x, 0);
+    // Vetor de filas de configuração de atividade das restrições:
+    std::vector<std::queue<bool>> conf(x);
+
+    unsigned int total = 0;
+
+    // Se a solução é do problema trivial:
+    if(x == 1)
+    {
+        // Não existe par de rainha para gerar restrição.
+        conf[0].push(false);
+        conf[0].push(false);
+    }
+
+    // Para todas as rainhas posteriores a primeira:
+    for(unsigned int i = 1; i <= x-1; i++)
+    {   
+        valida_exclusao_a_direita_do_limite_a_esquerda(0, i, i-0, S, cont, conf, &total);
+        valida_exclusao_a_esquerda_do_limite_a_direita(0, i, (x-1)-(i-0), S, cont, conf, &total);
+    }
+    // Para todas as rainhas posteriores a primeira e anteriores a última:
+    for(unsigned int k = 1; int(k) <= int(x-2); k++)
+    {
+        // Para todas as rainhas anteriores a (k+1)-ésima:
+        for(unsigned int i = 0; i <= k-1; i++)
+        {
+            valida_exclusao_a_direita_do_limite_a_esquerda(k, i, k-i, S, cont, conf, &total);
+            valida_exclusao_a_esquerda_do_limite_a_direita(k, i, (x-1)-(k-i), S, cont, conf, &total);
+        }
+        // Para todas as rainhas posteriores a (k+1)-ésima:
+        for(unsigned int i = k+1; i <= x-1; i++)
+        {
+            valida_exclusao_a_direita_do_limite_a_esquerda(k, i, i-k, S, cont, conf, &total);
+            valida_exclusao_a_esquerda_do_limite_a_direita(k, i, (x-1)-(i-k), S, cont, conf, &total);
+        }
+    }
+    // Para todas as rainhas anteriores a última:
+    for(unsigned int i = 0; int(i) <= int(x-2); i++)
+    {
+        valida_exclusao_a_direita_do_limite_a_esquerda(x-1, i, (x-1)-i, S, cont, conf, &total);
+        valida_exclusao_a_esquerda_do_limite_a_direita(x-1, i, i, S, cont, conf, &total); // lim = (x-1)-((x-1)-i) = i
+    }
+
+    if(imprime)
+    {
+        std::cout << std::endl;
+        imprime_vetor_de_naturais(x, S);
+        std::cout << std::endl;
+        std::cout << " --> ";
+        std::cout << std::endl;
+        imprime_vetor_de_naturais(x, cont.data());
+        std::cout << std::endl;
+        imprime_os_padroes_das_exclusoes(x, conf);
+        std::cout << std::endl;
+        std::cout << " (soma = " << total << ")";
+        std::cout << std::endl;
+        std::cout << std::endl;
+    }
+
+    // Retorna o número de restrições efetivas:
+    return total;
+}
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef GERADOR_DE_BITS_HPP
+#define GERADOR_DE_BITS_HPP
+
+#include <cstddef> // NULL
+#include <cstdint> // uint64_t
+#include <iostream> // cerr, endl
+#include <vector> // vector
+
+#include "./sumidouro.hpp"
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX_DE_BITS 64
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+inline uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades:
+    if(x == X_MAX_DE_BITS)
+    {
+        // Retorna a palavra cheia:
+        return ~uint64_t(0);
+    }
+    // Retorna os x bits menos significativos:
+    return (uint64_t(1) << x) - 1;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// k        : número de coordenadas do prefixo;
+// prefixo  : coordenadas das k primeiras rainhas (NULL se k é nulo);
+// s        : destino das soluções;
+// P, S     : memória de trabalho (estados e solução parcial), redimensionada
+//            para x e reaproveitada entre chamadas.
+// Gerador por tabuleiros de bits restrito às soluções que começam pelo
+// prefixo (a subárvore da busca abaixo dele, na mesma ordem).
+// Retorna falso se o destino interrompeu a geração:
+inline bool gera_solucoes_de_bits_com_memoria(unsigned int x, unsigned int k, const unsigned int* prefixo, Sumidouro& s,
+                                                std::vector<estado_de_bits>& P, std::vector<unsigned int>& S)
+{
+    // Se não cabe em uma palavra:
+    if(!x || x > X_MAX_DE_BITS)
+    {
+        std::cerr << "Erro. O número de possibilidades deve estar entre 1 e " << X_MAX_DE_BITS << "." << std::endl;
+        s.finaliza();
+        return true;
+    }
+    // Se o prefixo é maior que uma solução:
+    if(k > x)
+    {
+        std::cerr << "Erro. O prefixo deve ter no máximo " << x << " coordenadas." << std::endl;
+        s.finaliza();
+        return true;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+
+    // Estados de cada posição:
+    P.resize(x);
+
+    // Solução parcial:
+    S.resize(x);
+
+    // Estado da posição seguinte ao prefixo (começa pela primeira posição):
+    estado_de_bits e = {0, 0, 0, omega};
+    // Posiciona as rainhas do prefixo:
+    for(unsigned int j = 0; j < k; j++)
+    {
+        S[j] = prefixo[j];
+        // Se a coordenada está fora do tabuleiro ou é atacada, não há soluções:
+        if(S[j] >= x || !(e.livres & (uint64_t(1) << S[j])))
+        {
+            s.finaliza();
+            return true;
+        }
+        uint64_t bit = uint64_t(1) << S[j];
+        uint64_t c = e.colunas | bit;
+        uint64_t d = (e.diagonais | bit) << 1;
+        uint64_t a = (e.antidiagonais | bit) >> 1;
+        e = {c, d, a, omega & ~(c | d | a)};
+    }
+
+    // Se o prefixo já é uma solução:
+    if(k == x)
+    {
+        bool continua = s.recebe(x, S.data());
+        s.finaliza();
+        return continua;
+    }
+
+    // Inicia a posição seguinte ao prefixo:
+    P[k] = e;
+
+    // Índice de profundidade:
+    unsigned int i = k;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a posição seguinte ao prefixo, terminou a busca:
+            if(i == k)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+        // Salva a coordenada na solução parcial:
+        S[i] = __builtin_ctzll(bit);
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(i == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, S.data()))
+            {
+                s.finaliza();
+                return false;
+            }
+            continue;
+        }
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+    }
+
+    s.finaliza();
+    return true;
+}
+
+// x, k, prefixo, s: como em gera_solucoes_de_bits_com_memoria.
+// Gerador restrito ao prefixo, com memória de trabalho própria.
+// Retorna falso se o destino interrompeu a geração:
+inline bool gera_solucoes_de_bits_a_partir(unsigned int x, unsigned int k, const unsigned int* prefixo, Sumidouro& s)
+{
+    std::vector<estado_de_bits> P;
+    std::vector<unsigned int> S;
+    return gera_solucoes_de_bits_com_memoria(x, k, prefixo, s, P, S);
+}
+
+// x    : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// s    : destino das soluções.
+// Gerador por tabuleiros de bits (o da versão 14 de Gerador+Total).
+// Retorna falso se o destino interrompeu a geração:
+inline bool gera_solucoes_de_bits(unsigned int x, Sumidouro& s)
+{
+    return gera_solucoes_de_bits_a_partir(x, 0, NULL, s);
+}
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço;
+// k: número de coordenadas dos prefixos (de 1 a x).
+// Retorna os prefixos de k rainhas sem ataques entre si, contíguos (k
+// coordenadas por prefixo) e na ordem da busca. As subárvores dos
+// prefixos particionam a busca completa:
+inline std::vector<unsigned int> prefixos_de_bits(unsigned int x, unsigned int k)
+{
+    // Prefixos encontrados:
+    std::vector<unsigned int> R;
+    // Se não cabe em uma palavra ou o prefixo é vazio ou maior que uma solução:
+    if(!x || x > X_MAX_DE_BITS || !k || k > x)
+    {
+        return R;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+    // Estados de cada posição do prefixo:
+    std::vector<estado_de_bits> P(k);
+    // Prefixo parcial:
+    std::vector<unsigned int> S(k);
+
+    // Inicia a primeira posição com todas as possibilidades:
+    P[0] = {0, 0, 0, omega};
+    // Índice de profundidade:
+    unsigned int i = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+        // Salva a coordenada no prefixo parcial:
+        S[i] = __builtin_ctzll(bit);
+
+        // Se completou o prefixo, salva-o:
+        if(i == k-1)
+        {
+            R.insert(R.end(), S.begin(), S.end());
+            continue;
+        }
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+    }
+    return R;
+}
+
+#endif
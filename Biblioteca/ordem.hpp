@@ -0,0 +1,299 @@
+#ifndef ORDEM_HPP
+#define ORDEM_HPP
+
+#include <algorithm> // stable_sort
+#include <cstdint> // uint64_t
+#include <cstdlib> // abs
+#include <iostream> // cerr, endl
+#include <string> // string
+#include <vector> // vector
+
+#include "./sumidouro.hpp"
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX_DE_ORDEM 64
+
+// Estratégia de ordem da busca: qual posição (linha) recebe a próxima rainha
+// e em que ordem as possibilidades dessa posição são testadas. Por padrão,
+// as posições são preenchidas em ordem (0..x-1) e as possibilidades em ordem
+// crescente, como nos geradores anteriores:
+class EstrategiaDeOrdem
+{
+    public:
+        // Destrutor:
+        virtual ~EstrategiaDeOrdem() {}
+        // Nome da estratégia (para relatórios):
+        virtual const char* nome() const
+        {
+            return "fixa";
+        }
+        // x      : número de possibilidades;
+        // E      : possibilidades restantes de cada posição (bit v de E[i]);
+        // livres : posições ainda sem rainha (bit i).
+        // Retorna a posição que recebe a próxima rainha:
+        virtual unsigned int escolhe_posicao(unsigned int, const uint64_t*, uint64_t livres) const
+        {
+            return __builtin_ctzll(livres);
+        }
+        // x      : número de possibilidades;
+        // i      : posição escolhida;
+        // e      : possibilidades restantes da posição;
+        // S      : solução parcial (válida nas posições com rainha);
+        // livres : posições ainda sem rainha;
+        // V      : vetor que recebe as possibilidades na ordem de teste.
+        // Retorna o número de possibilidades:
+        virtual unsigned int ordena_possibilidades(unsigned int, unsigned int, uint64_t e, const unsigned int*,
+                                                    uint64_t, unsigned int* V) const
+        {
+            unsigned int m = 0;
+            for(; e; e &= e-1)
+            {
+                V[m++] = __builtin_ctzll(e);
+            }
+            return m;
+        }
+};
+
+// Posições em ordem e possibilidades do centro para as bordas:
+class OrdemDoCentro : public EstrategiaDeOrdem
+{
+    public:
+        // x: número de possibilidades.
+        OrdemDoCentro(unsigned int x)
+        {
+            // Ordena as possibilidades pela distância ao centro (a menor primeiro):
+            for(unsigned int v = 0; v < x; v++)
+            {
+                this->O.push_back(v);
+            }
+            std::stable_sort(this->O.begin(), this->O.end(), [x](unsigned int a, unsigned int b)
+            {
+                return std::abs(int(2*a) - int(x-1)) < std::abs(int(2*b) - int(x-1));
+            });
+        }
+        const char* nome() const override
+        {
+            return "centro para fora";
+        }
+        unsigned int ordena_possibilidades(unsigned int, unsigned int, uint64_t e, const unsigned int*,
+                                            uint64_t, unsigned int* V) const override
+        {
+            unsigned int m = 0;
+            for(auto v : this->O)
+            {
+                if((e >> v) & 1)
+                {
+                    V[m++] = v;
+                }
+            }
+            return m;
+        }
+    private:
+        // Ordem das possibilidades:
+        std::vector<unsigned int> O;
+};
+
+// Posições em ordem e possibilidades pela distância (cíclica) ao valor k
+// unidades à direita da rainha da posição anterior, como no salto do
+// cavalo das construções explícitas (a ideia de distância k de gerador_k):
+class OrdemPorDistancia : public EstrategiaDeOrdem
+{
+    public:
+        // k: distância preferida em relação à rainha anterior.
+        OrdemPorDistancia(unsigned int k)
+        {
+            this->k = k;
+        }
+        const char* nome() const override
+        {
+            return "distância à rainha anterior";
+        }
+        unsigned int ordena_possibilidades(unsigned int x, unsigned int i, uint64_t e, const unsigned int* S,
+                                            uint64_t livres, unsigned int* V) const override
+        {
+            unsigned int m = EstrategiaDeOrdem::ordena_possibilidades(x, i, e, S, livres, V);
+            // Se não há rainha na posição anterior, mantém a ordem crescente:
+            if(!i || (livres >> (i-1)) & 1)
+            {
+                return m;
+            }
+            // Valor preferido:
+            unsigned int alvo = (S[i-1] + this->k) % x;
+            // Ordena por inserção pela distância cíclica ao valor preferido:
+            for(unsigned int a = 1; a < m; a++)
+            {
+                unsigned int v = V[a], b = a;
+                for(; b > 0 && this->distancia(x, alvo, V[b-1]) > this->distancia(x, alvo, v); b--)
+                {
+                    V[b] = V[b-1];
+                }
+                V[b] = v;
+            }
+            return m;
+        }
+    private:
+        // Distância preferida:
+        unsigned int k;
+        // Distância cíclica entre dois valores:
+        static unsigned int distancia(unsigned int x, unsigned int a, unsigned int b)
+        {
+            unsigned int d = a > b ? a-b : b-a;
+            return d < x-d ? d : x-d;
+        }
+};
+
+// Acrescenta a escolha dinâmica da posição com menos possibilidades
+// restantes (MRV) a uma ordem de possibilidades:
+template<typename Possibilidades>
+class ComMRV : public Possibilidades
+{
+    public:
+        using Possibilidades::Possibilidades;
+        const char* nome() const override
+        {
+            return this->nome_composto.c_str();
+        }
+        unsigned int escolhe_posicao(unsigned int, const uint64_t* E, uint64_t livres) const override
+        {
+            unsigned int melhor = __builtin_ctzll(livres);
+            // Para todas as posições livres:
+            for(uint64_t l = livres & (livres-1); l; l &= l-1)
+            {
+                unsigned int i = __builtin_ctzll(l);
+                if(__builtin_popcountll(E[i]) < __builtin_popcountll(E[melhor]))
+                {
+                    melhor = i;
+                }
+            }
+            return melhor;
+        }
+    private:
+        // Nome da estratégia:
+        std::string nome_composto = std::string("MRV + ") + Possibilidades::nome();
+};
+
+// x    : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// O    : estratégia de ordem;
+// s    : destino das soluções;
+// nos  : número de nós (rainhas posicionadas) visitados;
+// limite: número máximo de nós (0 para nenhum).
+// Gerador com domínios de bits por posição e verificação adiante: cada rainha
+// remove das posições livres as possibilidades que ataca, e a busca retrocede
+// se alguma posição fica sem possibilidades. Retorna falso se o destino
+// ou o limite de nós interrompeu a geração:
+inline bool gera_solucoes_com_ordem(unsigned int x, const EstrategiaDeOrdem& O, Sumidouro& s, unsigned long long* nos,
+                                        unsigned long long limite = 0)
+{
+    *nos = 0;
+    // Se não cabe em uma palavra:
+    if(!x || x > X_MAX_DE_ORDEM)
+    {
+        std::cerr << "Erro. O número de possibilidades deve estar entre 1 e " << X_MAX_DE_ORDEM << "." << std::endl;
+        s.finaliza();
+        return true;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = x == 64 ? ~uint64_t(0) : (uint64_t(1) << x) - 1;
+
+    // Possibilidades de cada posição em cada profundidade (x palavras por profundidade):
+    std::vector<uint64_t> E(x*x, omega);
+    // Posições livres em cada profundidade:
+    std::vector<uint64_t> livres(x);
+    // Posição escolhida em cada profundidade:
+    std::vector<unsigned int> posicao(x);
+    // Possibilidades ordenadas, seu número e a próxima a testar em cada profundidade:
+    std::vector<unsigned int> V(x*x), m(x), proxima(x);
+    // Solução parcial:
+    std::vector<unsigned int> S(x);
+
+    // Índice de profundidade:
+    unsigned int d = 0;
+    livres[0] = x == 64 ? ~uint64_t(0) : (uint64_t(1) << x) - 1;
+    posicao[0] = O.escolhe_posicao(x, E.data(), livres[0]);
+    m[0] = O.ordena_possibilidades(x, posicao[0], E[posicao[0]], S.data(), livres[0], V.data());
+    proxima[0] = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da profundidade atual:
+        if(proxima[d] == m[d])
+        {
+            // Se é a primeira profundidade, terminou a busca:
+            if(!d)
+            {
+                break;
+            }
+            // Volta para a profundidade anterior:
+            d--;
+            continue;
+        }
+
+        // Posiciona a rainha na próxima possibilidade:
+        unsigned int i = posicao[d];
+        unsigned int v = V[d*x + proxima[d]++];
+        // Se atingiu o limite de nós, interrompe:
+        if(limite && *nos == limite)
+        {
+            s.finaliza();
+            return false;
+        }
+        S[i] = v;
+        (*nos)++;
+
+        // Se todas as posições têm rainha:
+        if(d == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, S.data()))
+            {
+                s.finaliza();
+                return false;
+            }
+            continue;
+        }
+
+        // Remove das posições livres as possibilidades atacadas pela rainha:
+        const uint64_t* A = E.data() + d*x;
+        uint64_t* B = E.data() + (d+1)*x;
+        livres[d+1] = livres[d] & ~(uint64_t(1) << i);
+        bool zerou = false;
+        for(uint64_t l = livres[d+1]; l; l &= l-1)
+        {
+            unsigned int j = __builtin_ctzll(l);
+            unsigned int distancia = j > i ? j-i : i-j;
+            uint64_t ataque = uint64_t(1) << v;
+            if(v + distancia < x)
+            {
+                ataque |= uint64_t(1) << (v + distancia);
+            }
+            if(v >= distancia)
+            {
+                ataque |= uint64_t(1) << (v - distancia);
+            }
+            B[j] = A[j] & ~ataque;
+            // Se a posição ficou sem possibilidades:
+            if(!B[j])
+            {
+                zerou = true;
+                break;
+            }
+        }
+        if(zerou)
+        {
+            continue;
+        }
+
+        // Avança para a profundidade seguinte:
+        d++;
+        posicao[d] = O.escolhe_posicao(x, B, livres[d]);
+        m[d] = O.ordena_possibilidades(x, posicao[d], B[posicao[d]], S.data(), livres[d], V.data() + d*x);
+        proxima[d] = 0;
+    }
+
+    s.finaliza();
+    return true;
+}
+
+#endif
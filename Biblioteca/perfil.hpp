@@ -0,0 +1,98 @@
+#ifndef PERFIL_HPP
+#define PERFIL_HPP
+
+#include <fstream> // ofstream
+#include <iomanip> // setw
+#include <iostream> // ostream, endl
+#include <vector> // vector
+
+// Contadores por profundidade de uma busca. Só são atualizados quando o
+// código é compilado com -DPERFIL_DE_BUSCA; sem essa opção, as macros
+// abaixo não geram instrução alguma no laço da busca. A estrutura existe
+// nas duas compilações para que o leiaute das classes que a contêm não
+// dependa da opção:
+struct PerfilDeBusca
+{
+    std::vector<unsigned long long> empilhados;      // estados gerados (possibilidades da posição ao entrar nela).
+    std::vector<unsigned long long> posicionamentos; // rainhas posicionadas.
+    std::vector<unsigned long long> becos;           // posicionamentos descartados porque alguma posição zerou.
+    std::vector<unsigned long long> remocoes;        // possibilidades removidas (casas que passaram a ser atacadas).
+    std::vector<unsigned long long> reinsercoes;     // possibilidades reinseridas ao retirar rainhas.
+
+    // x: número de profundidades.
+    // Zera os contadores:
+    void reinicia(unsigned int x)
+    {
+        this->empilhados.assign(x, 0);
+        this->posicionamentos.assign(x, 0);
+        this->becos.assign(x, 0);
+        this->remocoes.assign(x, 0);
+        this->reinsercoes.assign(x, 0);
+    }
+
+    // d: profundidade.
+    // Retorna o fator de ramificação efetivo: rainhas posicionadas na
+    // profundidade seguinte por rainha posicionada nesta:
+    double ramificacao(unsigned int d) const
+    {
+        if(d+1 >= this->posicionamentos.size() || !this->posicionamentos[d])
+        {
+            return 0.;
+        }
+        return double(this->posicionamentos[d+1])/double(this->posicionamentos[d]);
+    }
+
+    // o: destino da tabela.
+    // Imprime a tabela por profundidade e os totais:
+    void imprime(std::ostream& o) const
+    {
+        o << std::setw(6) << "prof." << std::setw(14) << "empilhados" << std::setw(14) << "posicion."
+            << std::setw(14) << "becos" << std::setw(14) << "remoções" << std::setw(14) << "reinserções"
+            << std::setw(12) << "ramific." << std::endl;
+        unsigned long long t[5] = {0, 0, 0, 0, 0};
+        for(unsigned int d = 0; d < this->posicionamentos.size(); d++)
+        {
+            o << std::setw(6) << d << std::setw(14) << this->empilhados[d] << std::setw(14) << this->posicionamentos[d]
+                << std::setw(14) << this->becos[d] << std::setw(14) << this->remocoes[d]
+                << std::setw(14) << this->reinsercoes[d] << std::setw(12) << this->ramificacao(d) << std::endl;
+            t[0] += this->empilhados[d];
+            t[1] += this->posicionamentos[d];
+            t[2] += this->becos[d];
+            t[3] += this->remocoes[d];
+            t[4] += this->reinsercoes[d];
+        }
+        o << std::setw(6) << "total";
+        for(auto v : t)
+        {
+            o << std::setw(14) << v;
+        }
+        o << std::endl;
+    }
+
+    // nome: arquivo CSV de destino.
+    // Exporta a tabela por profundidade. Retorna falso se não conseguiu gravar:
+    bool exporta(const char* nome) const
+    {
+        std::ofstream arquivo(nome);
+        arquivo << "profundidade,empilhados,posicionamentos,becos,remocoes,reinsercoes,ramificacao" << std::endl;
+        for(unsigned int d = 0; d < this->posicionamentos.size(); d++)
+        {
+            arquivo << d << "," << this->empilhados[d] << "," << this->posicionamentos[d] << "," << this->becos[d]
+                    << "," << this->remocoes[d] << "," << this->reinsercoes[d] << "," << this->ramificacao(d) << std::endl;
+        }
+        return bool(arquivo);
+    }
+};
+
+#if defined(PERFIL_DE_BUSCA)
+// P: perfil; campo: contador; d: profundidade; n: quantidade.
+#define PERFIL_REINICIA(P, x) ((P).reinicia(x))
+#define PERFIL_CONTA(P, campo, d) ((P).campo[d]++)
+#define PERFIL_SOMA(P, campo, d, n) ((P).campo[d] += (n))
+#else
+#define PERFIL_REINICIA(P, x) ((void)0)
+#define PERFIL_CONTA(P, campo, d) ((void)0)
+#define PERFIL_SOMA(P, campo, d, n) ((void)0)
+#endif
+
+#endif
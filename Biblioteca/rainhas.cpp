@@ -0,0 +1,492 @@
+#include <iostream> // cerr, endl
+
+#include "./rainhas.hpp"
+
+// motor: motor de busca inicial.
+Rainhas::Rainhas(MotorDeBusca motor)
+{
+    this->m = motor;
+    this->x = 0;
+    this->x_de_livres = 0;
+    this->topo = 0;
+    this->x_de_cobertura = 0;
+    this->n_sol = 0;
+    this->x_de_solucoes = 0;
+}
+
+Rainhas::~Rainhas()
+{
+    // Toda a memória pertence a vetores e é liberada por eles.
+}
+
+void Rainhas::escolhe_motor(MotorDeBusca motor)
+{
+    this->m = motor;
+}
+
+MotorDeBusca Rainhas::motor() const
+{
+    return this->m;
+}
+
+const char* Rainhas::nome_do_motor(MotorDeBusca motor)
+{
+    switch(motor)
+    {
+        case MOTOR_CONTADORES:              return "contadores (v6)";
+        case MOTOR_CONTADORES_E_CONJUNTOS:  return "contadores e conjuntos (v7)";
+        case MOTOR_VERIFICACAO_ADIANTE:     return "verificação adiante (v8-3)";
+        case MOTOR_BITS:                    return "tabuleiros de bits (v14)";
+        case MOTOR_COBERTURA_EXATA:         return "cobertura exata (v19)";
+    }
+    return "desconhecido";
+}
+
+bool Rainhas::gera(unsigned int x, Sumidouro& s)
+{
+    // Se número nulo:
+    if(!x)
+    {
+        std::cerr << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        s.finaliza();
+        return true;
+    }
+    this->x = x;
+    this->S.resize(x);
+    PERFIL_REINICIA(this->perfil_de_busca, x);
+    switch(this->m)
+    {
+        case MOTOR_CONTADORES:
+            return this->gera_por_contadores(s);
+        case MOTOR_CONTADORES_E_CONJUNTOS:
+            return this->gera_por_conjuntos(s);
+        case MOTOR_VERIFICACAO_ADIANTE:
+            return this->gera_por_verificacao_adiante(s);
+        case MOTOR_BITS:
+            return gera_solucoes_de_bits_com_memoria(x, 0, NULL, s, this->P, this->S);
+        case MOTOR_COBERTURA_EXATA:
+            // Monta a matriz só quando x muda (a busca a restaura ao terminar):
+            if(this->x_de_cobertura != x)
+            {
+                this->cobertura.reset(new CoberturaDeRainhas(x));
+                this->x_de_cobertura = x;
+            }
+            return this->cobertura->gera(s);
+    }
+    s.finaliza();
+    return true;
+}
+
+unsigned long long Rainhas::conta(unsigned int x)
+{
+    // A cobertura exata conta sem montar as soluções:
+    if(this->m == MOTOR_COBERTURA_EXATA && x)
+    {
+        if(this->x_de_cobertura != x)
+        {
+            this->cobertura.reset(new CoberturaDeRainhas(x));
+            this->x_de_cobertura = x;
+        }
+        return this->cobertura->conta();
+    }
+    unsigned long long n = 0;
+    SumidouroDeFuncao s([&n](unsigned int, const unsigned int*)
+    {
+        n++;
+        return true;
+    });
+    this->gera(x, s);
+    return n;
+}
+
+unsigned long long Rainhas::primeiras(unsigned int x, unsigned long long n)
+{
+    // Reaproveita a memória das soluções da chamada anterior:
+    this->R.clear();
+    this->n_sol = 0;
+    SumidouroDeFuncao s([&](unsigned int x, const unsigned int* S)
+    {
+        this->R.insert(this->R.end(), S, S+x);
+        this->n_sol++;
+        return !n || this->n_sol < n;
+    });
+    this->x_de_solucoes = x;
+    this->gera(x, s);
+    return this->n_sol;
+}
+
+unsigned long long Rainhas::numero_de_solucoes() const
+{
+    return this->n_sol;
+}
+
+const unsigned int* Rainhas::solucao(unsigned long long k) const
+{
+    return this->R.data() + k*this->x_de_solucoes;
+}
+
+const PerfilDeBusca& Rainhas::perfil() const
+{
+    return this->perfil_de_busca;
+}
+
+// k: profundidade; j: possibilidade; d: +1 para posicionar e -1 para retirar.
+void Rainhas::aplica_ataques(unsigned int k, unsigned int j, int d)
+{
+    unsigned int x = this->x;
+    // Para todas as posições seguintes:
+    for(unsigned int i = 1; i <= x-k-1; i++)
+    {
+        unsigned int* L = this->C.data() + (k+i)*x;
+#if defined(PERFIL_DE_BUSCA)
+        // Casas que passam a ser atacadas (ou deixam de ser):
+        unsigned int alvo = d > 0 ? 0 : 1;
+        unsigned int n = (L[j] == alvo) + (j >= i && L[j-i] == alvo) + (j+i <= x-1 && L[j+i] == alvo);
+        if(d > 0)
+        {
+            PERFIL_SOMA(this->perfil_de_busca, remocoes, k, n);
+        } else
+        {
+            PERFIL_SOMA(this->perfil_de_busca, reinsercoes, k, n);
+        }
+#endif
+        // Mesma coluna, diagonal à esquerda e diagonal à direita:
+        L[j] += d;
+        if(j >= i)
+        {
+            L[j-i] += d;
+        }
+        if(j+i <= x-1)
+        {
+            L[j+i] += d;
+        }
+    }
+}
+
+// Busca da versão 6 (mesma ordem), iterativa: a matriz de contadores indica
+// quantas rainhas anteriores atacam cada casa das posições seguintes. Toda
+// busca termina com os contadores zerados (inclusive se interrompida):
+bool Rainhas::gera_por_contadores(Sumidouro& s)
+{
+    unsigned int x = this->x;
+    // Se a matriz não é do x atual, refaz (e invalida os conjuntos da versão 7):
+    if(this->C.size() != x*x)
+    {
+        this->C.assign(x*x, 0);
+        this->x_de_livres = 0;
+    }
+    this->proxima.resize(x);
+
+    // Índice de profundidade:
+    unsigned int k = 0;
+    this->proxima[0] = 0;
+    while(true)
+    {
+        // Procura a próxima possibilidade não atacada da posição:
+        const unsigned int* L = this->C.data() + k*x;
+        unsigned int j = this->proxima[k];
+#if defined(PERFIL_DE_BUSCA)
+        // Ao entrar na posição, conta as suas possibilidades (e o beco, se não há):
+        if(!j)
+        {
+            unsigned int n = 0;
+            for(unsigned int v = 0; v < x; v++)
+            {
+                n += !L[v];
+            }
+            PERFIL_SOMA(this->perfil_de_busca, empilhados, k, n);
+            if(!n && k)
+            {
+                PERFIL_CONTA(this->perfil_de_busca, becos, k-1);
+            }
+        }
+#endif
+        for(; j < x && L[j]; j++);
+
+        // Se esgotou as possibilidades da posição:
+        if(j == x)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!k)
+            {
+                break;
+            }
+            // Volta para a posição anterior e retira a sua rainha:
+            k--;
+            this->aplica_ataques(k, this->S[k], -1);
+            continue;
+        }
+
+        this->S[k] = j;
+        this->proxima[k] = j+1;
+        PERFIL_CONTA(this->perfil_de_busca, posicionamentos, k);
+
+        // Se completou uma solução:
+        if(k == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, this->S.data()))
+            {
+                // Retira as rainhas posicionadas:
+                while(k--)
+                {
+                    this->aplica_ataques(k, this->S[k], -1);
+                }
+                s.finaliza();
+                return false;
+            }
+            continue;
+        }
+
+        // Posiciona a rainha e avança:
+        this->aplica_ataques(k, j, +1);
+        k++;
+        this->proxima[k] = 0;
+    }
+
+    s.finaliza();
+    return true;
+}
+
+// k: profundidade; j: possibilidade; d: +1 para posicionar e -1 para retirar.
+void Rainhas::aplica_ataques_em_conjuntos(unsigned int k, unsigned int j, int d)
+{
+    unsigned int x = this->x;
+    // Atualiza um contador, retirando a casa do conjunto quando passa a ser
+    // atacada e devolvendo-a quando deixa de ser:
+    auto atualiza = [&](unsigned int p, unsigned int v)
+    {
+        unsigned int& c = this->C[p*x + v];
+        if(d > 0 && !c++)
+        {
+            this->livres[p].erase(v);
+            PERFIL_CONTA(this->perfil_de_busca, remocoes, k);
+        } else if(d < 0 && !--c)
+        {
+            this->livres[p].insert(v);
+            PERFIL_CONTA(this->perfil_de_busca, reinsercoes, k);
+        }
+    };
+    // Para todas as posições seguintes:
+    for(unsigned int i = 1; i <= x-k-1; i++)
+    {
+        atualiza(k+i, j);
+        if(j >= i)
+        {
+            atualiza(k+i, j-i);
+        }
+        if(j+i <= x-1)
+        {
+            atualiza(k+i, j+i);
+        }
+    }
+}
+
+// Busca da versão 7 (mesma ordem), iterativa: além dos contadores, cada
+// posição tem o conjunto das possibilidades não atacadas, percorrido
+// diretamente. Toda busca termina com os contadores zerados e os conjuntos
+// cheios (inclusive se interrompida), então eles são reaproveitados
+// enquanto x não muda:
+bool Rainhas::gera_por_conjuntos(Sumidouro& s)
+{
+    unsigned int x = this->x;
+    // Se os conjuntos não são do x atual, monta-os:
+    if(this->x_de_livres != x)
+    {
+        this->C.assign(x*x, 0);
+        this->livres.resize(x);
+        for(auto& L : this->livres)
+        {
+            L.clear();
+            for(unsigned int v = 0; v < x; v++)
+            {
+                L.insert(L.end(), v);
+            }
+        }
+        this->x_de_livres = x;
+    }
+    this->proxima.resize(x);
+
+    // Índice de profundidade:
+    unsigned int k = 0;
+    this->proxima[0] = 0;
+    // Se o destino interrompeu:
+    bool interrompeu = false;
+    while(true)
+    {
+#if defined(PERFIL_DE_BUSCA)
+        // Ao entrar na posição, conta as suas possibilidades (e o beco, se não há):
+        if(!this->proxima[k])
+        {
+            PERFIL_SOMA(this->perfil_de_busca, empilhados, k, this->livres[k].size());
+            if(this->livres[k].empty() && k)
+            {
+                PERFIL_CONTA(this->perfil_de_busca, becos, k-1);
+            }
+        }
+#endif
+        // Próxima possibilidade não atacada da posição:
+        auto it = this->livres[k].lower_bound(this->proxima[k]);
+
+        // Se esgotou as possibilidades da posição:
+        if(it == this->livres[k].end())
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!k)
+            {
+                break;
+            }
+            // Volta para a posição anterior e retira a sua rainha:
+            k--;
+            this->aplica_ataques_em_conjuntos(k, this->S[k], -1);
+            continue;
+        }
+
+        unsigned int j = *it;
+        this->S[k] = j;
+        this->proxima[k] = j+1;
+        PERFIL_CONTA(this->perfil_de_busca, posicionamentos, k);
+
+        // Se completou uma solução:
+        if(k == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, this->S.data()))
+            {
+                interrompeu = true;
+                break;
+            }
+            continue;
+        }
+
+        // Posiciona a rainha e avança:
+        this->aplica_ataques_em_conjuntos(k, j, +1);
+        k++;
+        this->proxima[k] = 0;
+    }
+
+    // Se interrompeu, retira as rainhas posicionadas (restaura os conjuntos):
+    if(interrompeu)
+    {
+        while(k--)
+        {
+            this->aplica_ataques_em_conjuntos(k, this->S[k], -1);
+        }
+    }
+    s.finaliza();
+    return !interrompeu;
+}
+
+// p: posição; v: possibilidade; d: profundidade da rainha que a remove.
+bool Rainhas::remove_possibilidade(unsigned int p, unsigned int v, unsigned int d)
+{
+    unsigned int x = this->x;
+    // Se a possibilidade está fora do tabuleiro ou já foi removida:
+    if(v >= x || !this->E[p*x + v])
+    {
+        return false;
+    }
+    // Remove e registra a remoção na trilha:
+    this->E[p*x + v] = 0;
+    this->n[p]--;
+    this->trilha[this->topo++] = {p, v, d};
+    return !this->n[p];
+}
+
+// i: profundidade a partir da qual as remoções são desfeitas.
+void Rainhas::desfaz_remocoes(unsigned int i)
+{
+    // Desempilha a trilha até a marca da profundidade:
+    while(this->topo > this->marca[i])
+    {
+        Remocao r = this->trilha[--this->topo];
+        this->E[r.p*this->x + r.v] = 1;
+        this->n[r.p]++;
+        // Atribuída à profundidade que fez a remoção, como nas versões 6 e 7:
+        PERFIL_CONTA(this->perfil_de_busca, reinsercoes, r.d);
+    }
+}
+
+// Busca da versão 8-3 (mesmos estados e ordem da versão 8): domínios por
+// vetor de presença, remoções registradas em uma trilha única e pilha
+// explícita de estados:
+bool Rainhas::gera_por_verificacao_adiante(Sumidouro& s)
+{
+    unsigned int x = this->x;
+    this->E.assign(x*x, 1);
+    this->n.assign(x, x);
+    // Cada possibilidade de cada posição é removida no máximo uma vez enquanto ausente:
+    this->trilha.resize(x*x);
+    this->topo = 0;
+    this->marca.assign(x, 0);
+    this->pilha.clear();
+
+    // Para todas as possibilidades, empilha estado inicial:
+    for(unsigned int p = 0; p <= x-1; p++)
+    {
+        this->pilha.push_back({0, p});
+    }
+    PERFIL_SOMA(this->perfil_de_busca, empilhados, 0, x);
+
+    // Enquanto houver estados:
+    while(!this->pilha.empty())
+    {
+        // Pega e desempilha o estado no topo da pilha:
+        Estado q = this->pilha.back();
+        this->pilha.pop_back();
+
+        // Desfaz as remoções das rainhas de profundidade q.i em diante:
+        this->desfaz_remocoes(q.i);
+        this->S[q.i] = q.r;
+        PERFIL_CONTA(this->perfil_de_busca, posicionamentos, q.i);
+
+        // Se completou uma solução:
+        if(q.i == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, this->S.data()))
+            {
+                this->desfaz_remocoes(0);
+                s.finaliza();
+                return false;
+            }
+            continue;
+        }
+
+        // Remove das posições seguintes as possibilidades atacadas pela rainha:
+#if defined(PERFIL_DE_BUSCA)
+        unsigned int topo_antes = this->topo;
+#endif
+        bool zerou = false;
+        for(unsigned int j = 1; j <= (x-1)-q.i && !zerou; j++)
+        {
+            zerou = this->remove_possibilidade(q.i+j, q.r-j, q.i) || this->remove_possibilidade(q.i+j, q.r, q.i)
+                        || this->remove_possibilidade(q.i+j, q.r+j, q.i);
+        }
+        PERFIL_SOMA(this->perfil_de_busca, remocoes, q.i, this->topo - topo_antes);
+        if(zerou)
+        {
+            PERFIL_CONTA(this->perfil_de_busca, becos, q.i);
+        }
+        // Se as remoções não zeram as possibilidades de nenhuma posição:
+        if(!zerou)
+        {
+            // Marca o início das remoções dos estados da posição seguinte:
+            this->marca[q.i+1] = this->topo;
+            // Para todas as possibilidades da posição seguinte:
+            for(unsigned int v = 0; v < x; v++)
+            {
+                if(this->E[(q.i+1)*x + v])
+                {
+                    this->pilha.push_back({q.i+1, v});
+                    PERFIL_CONTA(this->perfil_de_busca, empilhados, q.i+1);
+                }
+            }
+        }
+    }
+
+    // Desfaz as remoções que restaram na trilha (cada remoção tem sua reinserção):
+    this->desfaz_remocoes(0);
+    s.finaliza();
+    return true;
+}
@@ -0,0 +1,139 @@
+#ifndef RAINHAS_HPP
+#define RAINHAS_HPP
+
+#include <memory> // unique_ptr
+#include <set> // set
+#include <vector> // vector
+
+#include "./cobertura_exata.hpp"
+#include "./gerador_de_bits.hpp"
+#include "./perfil.hpp"
+#include "./sumidouro.hpp"
+
+// Motores de busca do solucionador:
+enum MotorDeBusca
+{
+    MOTOR_CONTADORES,               // matriz de contadores de ataques (versão 6).
+    MOTOR_CONTADORES_E_CONJUNTOS,   // contadores e conjuntos de possibilidades (versão 7).
+    MOTOR_VERIFICACAO_ADIANTE,      // verificação adiante com trilha de remoções (versões 8 e 8-3).
+    MOTOR_BITS,                     // tabuleiros de bits (versão 14), para x até 64.
+    MOTOR_COBERTURA_EXATA           // cobertura exata por Dancing Links (versão 19).
+};
+
+// Solucionador do problema (2, x)-Rainhas Padrão para uso repetido. A
+// memória de trabalho (contadores, domínios, trilha, pilha) pertence ao
+// objeto e é reaproveitada entre as chamadas: só é realocada quando x
+// excede o maior x já usado, e os conjuntos da versão 7 e a matriz de
+// cobertura exata só são reconstruídos quando x muda. As operações não
+// são seguras entre linhas de execução; use um objeto por linha:
+class Rainhas
+{
+    public:
+        // motor: motor de busca inicial.
+        Rainhas(MotorDeBusca motor = MOTOR_BITS);
+        // Destrutor:
+        ~Rainhas();
+
+        // motor: motor de busca das próximas chamadas.
+        void escolhe_motor(MotorDeBusca motor);
+        // Retorna o motor de busca atual:
+        MotorDeBusca motor() const;
+        // Retorna o nome de um motor de busca (para relatórios):
+        static const char* nome_do_motor(MotorDeBusca motor);
+
+        // x: número de possibilidades;
+        // s: destino das soluções.
+        // Enumera as soluções. Retorna falso se o destino interrompeu a geração:
+        bool gera(unsigned int x, Sumidouro& s);
+        // x: número de possibilidades.
+        // Retorna o número de soluções:
+        unsigned long long conta(unsigned int x);
+        // x: número de possibilidades;
+        // n: número máximo de soluções (0 para todas).
+        // Guarda as n primeiras soluções na ordem do motor e retorna quantas guardou:
+        unsigned long long primeiras(unsigned int x, unsigned long long n);
+
+        // Número de soluções guardadas pela última chamada de primeiras:
+        unsigned long long numero_de_solucoes() const;
+        // k: índice da solução guardada.
+        // Retorna as x coordenadas da (k+1)-ésima solução guardada:
+        const unsigned int* solucao(unsigned long long k) const;
+
+        // Contadores por profundidade da última busca dos motores das versões
+        // 6, 7 e 8-3 (só preenchidos se compilado com -DPERFIL_DE_BUSCA):
+        const PerfilDeBusca& perfil() const;
+
+    private:
+        // Remoção de uma possibilidade do domínio de uma posição:
+        struct Remocao
+        {
+            unsigned int p; // índice da posição.
+            unsigned int v; // possibilidade removida.
+            unsigned int d; // profundidade da rainha que fez a remoção.
+        };
+        // Estado da pilha da verificação adiante:
+        struct Estado
+        {
+            unsigned int i; // índice de profundidade.
+            unsigned int r; // coordenada de rainha.
+        };
+
+        // Motor de busca atual:
+        MotorDeBusca m;
+        // Número de possibilidades da busca atual:
+        unsigned int x;
+
+        // Solução parcial:
+        std::vector<unsigned int> S;
+        // Próxima possibilidade a testar em cada profundidade (versões 6 e 7):
+        std::vector<unsigned int> proxima;
+        // Ataques recebidos pela possibilidade v da posição p, em C[p*x+v] (versões 6 e 7;
+        // zerados entre as chamadas):
+        std::vector<unsigned int> C;
+        // Possibilidades não atacadas de cada posição (versão 7) e seu x (0 se não montados):
+        std::vector<std::set<unsigned int>> livres;
+        unsigned int x_de_livres;
+
+        // Presença da possibilidade v na posição p, em E[p*x+v] (verificação adiante):
+        std::vector<unsigned char> E;
+        // Número de possibilidades presentes em cada posição:
+        std::vector<unsigned int> n;
+        // Trilha de remoções, seu topo e a marca de cada profundidade:
+        std::vector<Remocao> trilha;
+        unsigned int topo;
+        std::vector<unsigned int> marca;
+        // Pilha de estados:
+        std::vector<Estado> pilha;
+
+        // Estados da busca por tabuleiros de bits:
+        std::vector<estado_de_bits> P;
+
+        // Matriz de cobertura exata e seu x (0 se não montada):
+        std::unique_ptr<CoberturaDeRainhas> cobertura;
+        unsigned int x_de_cobertura;
+
+        // Contadores por profundidade:
+        PerfilDeBusca perfil_de_busca;
+
+        // Soluções guardadas (x coordenadas por solução), seu número e seu x:
+        std::vector<unsigned int> R;
+        unsigned long long n_sol;
+        unsigned int x_de_solucoes;
+
+        // Motores:
+        bool gera_por_contadores(Sumidouro& s);
+        bool gera_por_conjuntos(Sumidouro& s);
+        bool gera_por_verificacao_adiante(Sumidouro& s);
+        // k: profundidade; j: possibilidade; d: +1 para posicionar e -1 para retirar.
+        // Atualiza os ataques da rainha (k, j) sobre as posições seguintes:
+        void aplica_ataques(unsigned int k, unsigned int j, int d);
+        // Idem, mantendo os conjuntos de possibilidades não atacadas:
+        void aplica_ataques_em_conjuntos(unsigned int k, unsigned int j, int d);
+        // p: posição; v: possibilidade; d: profundidade da rainha que a remove.
+        // Remove a possibilidade do domínio e retorna se o domínio zerou:
+        bool remove_possibilidade(unsigned int p, unsigned int v, unsigned int d);
+        // i: profundidade a partir da qual as remoções são desfeitas:
+        void desfaz_remocoes(unsigned int i);
+};
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef SUMIDOURO_HPP
+#define SUMIDOURO_HPP
+
+#include <cstdlib> // malloc, realloc, exit
+#include <functional> // function
+#include <iostream> // cerr, endl
+#include <vector> // vector
+
+// Destino das soluções de um gerador. Cada solução é entregue no momento
+// em que é encontrada, e o gerador não guarda nenhuma delas:
+class Sumidouro
+{
+    public:
+        // Destrutor:
+        virtual ~Sumidouro() {}
+        // x: número de possibilidades de valores para as
+        //    coordenadas de uma casa de um (2, x)-tabuleiro;
+        // S: solução encontrada (válida apenas durante a chamada).
+        // Retorna falso para interromper a geração:
+        virtual bool recebe(unsigned int x, const unsigned int* S) = 0;
+        // Chamada pelo gerador ao fim da geração (mesmo se interrompida):
+        virtual void finaliza() {}
+};
+
+// Entrega cada solução a uma função:
+class SumidouroDeFuncao : public Sumidouro
+{
+    public:
+        // f: função chamada com (x, S), que retorna falso para interromper a geração.
+        SumidouroDeFuncao(std::function<bool(unsigned int, const unsigned int*)> f)
+        {
+            this->f = f;
+        }
+        bool recebe(unsigned int x, const unsigned int* S) override
+        {
+            return this->f(x, S);
+        }
+    private:
+        // Função de processamento:
+        std::function<bool(unsigned int, const unsigned int*)> f;
+};
+
+// Agrupa as soluções em lotes contíguos (x coordenadas por solução)
+// e entrega cada lote cheio (e o último, ao fim) a uma função:
+class SumidouroDeLotes : public Sumidouro
+{
+    public:
+        // n: número de soluções por lote;
+        // f: função chamada com (x, número de soluções do lote, lote),
+        //    que retorna falso para interromper a geração.
+        SumidouroDeLotes(unsigned int n, std::function<bool(unsigned int, unsigned int, const unsigned int*)> f)
+        {
+            this->n = n ? n : 1;
+            this->f = f;
+            this->m = 0;
+            this->x = 0;
+        }
+        bool recebe(unsigned int x, const unsigned int* S) override
+        {
+            // Acrescenta a solução ao lote:
+            this->x = x;
+            this->lote.insert(this->lote.end(), S, S+x);
+            this->m++;
+            // Se o lote encheu, entrega:
+            if(this->m == this->n)
+            {
+                return this->descarrega();
+            }
+            return true;
+        }
+        void finaliza() override
+        {
+            // Se há lote incompleto, entrega:
+            if(this->m)
+            {
+                this->descarrega();
+            }
+        }
+    private:
+        // Soluções por lote:
+        unsigned int n;
+        // Soluções no lote atual:
+        unsigned int m;
+        // Número de possibilidades das soluções do lote:
+        unsigned int x;
+        // Lote atual:
+        std::vector<unsigned int> lote;
+        // Função de processamento:
+        std::function<bool(unsigned int, unsigned int, const unsigned int*)> f;
+
+        // Entrega o lote atual e o esvazia:
+        bool descarrega()
+        {
+            bool continua = this->f(this->x, this->m, this->lote.data());
+            this->lote.clear();
+            this->m = 0;
+            return continua;
+        }
+};
+
+// Salva as soluções no formato dos geradores anteriores (vetor R de
+// soluções alocadas com malloc, liberadas pelo chamador com free):
+class SumidouroDeConjunto : public Sumidouro
+{
+    public:
+        // n_sol    : número de soluções salvas;
+        // R        : conjunto de soluções (alocado pelo chamador);
+        // n_des    : número de soluções desejadas (0 para todas).
+        SumidouroDeConjunto(unsigned int* n_sol, unsigned int*** R, unsigned int n_des = 0)
+        {
+            this->n_sol = n_sol;
+            this->R = R;
+            this->n_des = n_des;
+            // O chamador alocou ao menos uma posição:
+            this->capacidade = (*n_sol) ? (*n_sol) : 1;
+        }
+        bool recebe(unsigned int x, const unsigned int* S) override
+        {
+            // Se não há espaço, dobra a capacidade (em vez de realocar a cada solução):
+            if(*(this->n_sol) == this->capacidade)
+            {
+                this->capacidade *= 2;
+                (*this->R) = (unsigned int**)realloc((*this->R), sizeof(unsigned int*)*this->capacidade);
+                if(*this->R == NULL)
+                {
+                    std::cerr << "Erro de alocação de memória." << std::endl;
+                    exit(1);
+                }
+            }
+            // Salva a solução:
+            (*this->R)[*(this->n_sol)] = (unsigned int*)malloc(sizeof(unsigned int)*x);
+            for(unsigned int i = 0; i <= x-1; i++)
+            {
+                (*this->R)[*(this->n_sol)][i] = S[i];
+            }
+            (*(this->n_sol))++;
+            // Continua enquanto não encontrou o número de soluções desejado:
+            return !this->n_des || *(this->n_sol) < this->n_des;
+        }
+    private:
+        // Número de soluções salvas:
+        unsigned int* n_sol;
+        // Conjunto de soluções:
+        unsigned int*** R;
+        // Número de soluções desejadas:
+        unsigned int n_des;
+        // Número de posições alocadas em R:
+        unsigned int capacidade;
+};
+
+#endif
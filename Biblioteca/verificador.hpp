@@ -0,0 +1,192 @@
+#ifndef VERIFICADOR_HPP
+#define VERIFICADOR_HPP
+
+// Observação: compilar com -march=native habilita os caminhos AVX2 e
+// AVX-512 (se disponíveis); sem eles, a verificação é escalar.
+
+#include <cstddef> // NULL
+#include <cstdint> // uint64_t
+#include <vector> // vector
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Os intrínsecos AVX-512 do GCC 12 acusam falsos "may be used uninitialized":
+#if defined(__AVX512F__) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Maior número de possibilidades verificado em palavras únicas (as 2x-1
+// diagonais de um tabuleiro de lado 32 cabem em uma palavra de 64 bits):
+#define X_MAX_DE_VERIFICACAO_EM_PALAVRA 32
+
+// x: número de possibilidades de valores para as
+//    coordenadas de uma casa de um (2, x)-tabuleiro;
+// S: suposta solução.
+// Verificação em O(x): marca a coluna, a diagonal (S[j]+j) e a antidiagonal
+// (S[j]+x-1-j) de cada rainha em máscaras de bits. As x colunas marcadas
+// preenchem a máscara de possibilidades se e somente se S é permutação de
+// 0..x-1, então só as diagonais precisam de teste de colisão:
+inline bool eh_solucao_de_bits(unsigned int x, const unsigned int* S)
+{
+    // Se as máscaras cabem em palavras únicas:
+    if(x <= X_MAX_DE_VERIFICACAO_EM_PALAVRA)
+    {
+        uint64_t c = 0, d = 0, a = 0;
+        for(unsigned int j = 0; j < x; j++)
+        {
+            // Se a coordenada está fora do tabuleiro:
+            if(S[j] >= x)
+            {
+                return false;
+            }
+            uint64_t bd = uint64_t(1) << (S[j]+j);
+            uint64_t ba = uint64_t(1) << (S[j]+x-1-j);
+            // Se a diagonal ou a antidiagonal já está ocupada:
+            if((d & bd) | (a & ba))
+            {
+                return false;
+            }
+            c |= uint64_t(1) << S[j];
+            d |= bd;
+            a |= ba;
+        }
+        return c == (uint64_t(1) << x) - 1;
+    }
+
+    // Senão, usa máscaras de várias palavras (colunas, diagonais e antidiagonais):
+    unsigned int palavras = (2*x-1+63)/64;
+    std::vector<uint64_t> M(3*palavras, 0);
+    uint64_t* c = M.data();
+    uint64_t* d = c + palavras;
+    uint64_t* a = d + palavras;
+    for(unsigned int j = 0; j < x; j++)
+    {
+        // Se a coordenada está fora do tabuleiro:
+        if(S[j] >= x)
+        {
+            return false;
+        }
+        unsigned int q = S[j], p = S[j]+j, r = S[j]+x-1-j;
+        // Se a coluna, a diagonal ou a antidiagonal já está ocupada:
+        if(((c[q/64] >> (q%64)) | (d[p/64] >> (p%64)) | (a[r/64] >> (r%64))) & 1)
+        {
+            return false;
+        }
+        c[q/64] |= uint64_t(1) << (q%64);
+        d[p/64] |= uint64_t(1) << (p%64);
+        a[r/64] |= uint64_t(1) << (r%64);
+    }
+    return true;
+}
+
+// x    : número de possibilidades de valores para as
+//        coordenadas de uma casa de um (2, x)-tabuleiro;
+// n    : número de supostas soluções do lote;
+// lote : supostas soluções contíguas (x coordenadas por solução);
+// V    : vetor de n resultados (true se é solução), ou NULL se não desejado.
+// Retorna o número de falsas soluções do lote. Para x <= 32, verifica
+// 8 (AVX-512) ou 4 (AVX2) soluções por vez, uma por faixa de 64 bits:
+inline unsigned long long verifica_lote(unsigned int x, unsigned long long n, const unsigned int* lote, bool* V = NULL)
+{
+    // Número de falsas soluções:
+    unsigned long long n_f_sol = 0;
+    // Índice da primeira solução ainda não verificada:
+    unsigned long long k = 0;
+
+#if defined(__AVX2__)
+    if(x <= X_MAX_DE_VERIFICACAO_EM_PALAVRA)
+    {
+        uint64_t omega = (uint64_t(1) << x) - 1;
+#if defined(__AVX512F__)
+        // Deslocamentos das 8 soluções de um grupo em relação à primeira:
+        __m256i I8 = _mm256_setr_epi32(0, x, 2*x, 3*x, 4*x, 5*x, 6*x, 7*x);
+        __m512i um8 = _mm512_set1_epi64(1);
+        __m512i omega8 = _mm512_set1_epi64((long long)omega);
+        // Para todos os grupos completos de 8 soluções:
+        for(; k+8 <= n; k += 8)
+        {
+            const unsigned int* G = lote + k*x;
+            __m512i c = _mm512_setzero_si512(), d = c, a = c, colisao = c;
+            for(unsigned int j = 0; j < x; j++)
+            {
+                // Coordenadas da (j+1)-ésima rainha das 8 soluções:
+                __m512i v = _mm512_cvtepu32_epi64(_mm256_i32gather_epi32((const int*)(G+j), I8, 4));
+                __m512i bd = _mm512_sllv_epi64(um8, _mm512_add_epi64(v, _mm512_set1_epi64(j)));
+                __m512i ba = _mm512_sllv_epi64(um8, _mm512_add_epi64(v, _mm512_set1_epi64(x-1-j)));
+                colisao = _mm512_or_si512(colisao, _mm512_or_si512(_mm512_and_si512(d, bd), _mm512_and_si512(a, ba)));
+                // Coordenadas de 64 em diante não marcam coluna (o deslocamento zera):
+                c = _mm512_or_si512(c, _mm512_sllv_epi64(um8, v));
+                d = _mm512_or_si512(d, bd);
+                a = _mm512_or_si512(a, ba);
+            }
+            // Faixas com colunas completas e sem colisões de diagonais:
+            __mmask8 ok = _mm512_cmpeq_epi64_mask(c, omega8) & _mm512_cmpeq_epi64_mask(colisao, _mm512_setzero_si512());
+            n_f_sol += 8 - __builtin_popcount(ok);
+            if(V)
+            {
+                for(unsigned int l = 0; l < 8; l++)
+                {
+                    V[k+l] = (ok >> l) & 1;
+                }
+            }
+        }
+#endif
+        // Deslocamentos das 4 soluções de um grupo em relação à primeira:
+        __m128i I4 = _mm_setr_epi32(0, x, 2*x, 3*x);
+        __m256i um4 = _mm256_set1_epi64x(1);
+        __m256i omega4 = _mm256_set1_epi64x((long long)omega);
+        // Para todos os grupos completos de 4 soluções (restantes):
+        for(; k+4 <= n; k += 4)
+        {
+            const unsigned int* G = lote + k*x;
+            __m256i c = _mm256_setzero_si256(), d = c, a = c, colisao = c;
+            for(unsigned int j = 0; j < x; j++)
+            {
+                // Coordenadas da (j+1)-ésima rainha das 4 soluções:
+                __m256i v = _mm256_cvtepu32_epi64(_mm_i32gather_epi32((const int*)(G+j), I4, 4));
+                __m256i bd = _mm256_sllv_epi64(um4, _mm256_add_epi64(v, _mm256_set1_epi64x(j)));
+                __m256i ba = _mm256_sllv_epi64(um4, _mm256_add_epi64(v, _mm256_set1_epi64x(x-1-j)));
+                colisao = _mm256_or_si256(colisao, _mm256_or_si256(_mm256_and_si256(d, bd), _mm256_and_si256(a, ba)));
+                // Coordenadas de 64 em diante não marcam coluna (o deslocamento zera):
+                c = _mm256_or_si256(c, _mm256_sllv_epi64(um4, v));
+                d = _mm256_or_si256(d, bd);
+                a = _mm256_or_si256(a, ba);
+            }
+            // Faixas com colunas completas e sem colisões de diagonais:
+            __m256i ok = _mm256_and_si256(_mm256_cmpeq_epi64(c, omega4), _mm256_cmpeq_epi64(colisao, _mm256_setzero_si256()));
+            unsigned int m = _mm256_movemask_pd(_mm256_castsi256_pd(ok));
+            n_f_sol += 4 - __builtin_popcount(m);
+            if(V)
+            {
+                for(unsigned int l = 0; l < 4; l++)
+                {
+                    V[k+l] = (m >> l) & 1;
+                }
+            }
+        }
+    }
+#endif
+
+    // Verifica as soluções restantes (ou todas, sem vetorização):
+    for(; k < n; k++)
+    {
+        bool ok = eh_solucao_de_bits(x, lote + k*x);
+        if(!ok)
+        {
+            n_f_sol++;
+        }
+        if(V)
+        {
+            V[k] = ok;
+        }
+    }
+    return n_f_sol;
+}
+
+#if defined(__AVX512F__) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
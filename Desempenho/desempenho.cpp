@@ -0,0 +1,484 @@
+// Para compilar (a partir desta pasta):
+// g++ desempenho.cpp -o desempenho.exe -Wall -O2
+// Para executar:
+// ./desempenho.exe [x_mínimo x_máximo [repetições [n_des,n_des,... [saída.json]]]]
+// Compila cada gerador em bin/ com as mesmas opções, executa-o sem interação
+// (as respostas dos prompts vão pela entrada padrão) para cada x da grade (e
+// cada n_des, nos geradores limitados) e grava os resultados em JSON. O código
+// de saída é 1 se algum gerador encontrou um número de soluções errado (os que
+// não compilam, como alguns rascunhos, são apenas relatados). Os arquivos de
+// trabalho dos geradores (rainhas-*) nesta pasta são apagados antes de cada execução.
+
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#error "O medidor de desempenho usa fork/exec e wait4 (POSIX)."
+#endif
+#include <csignal>
+#include <glob.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Números de soluções conhecidos do problema (2, x)-Rainhas Padrão (índice x):
+const unsigned long long SOLUCOES_CONHECIDAS[] = {0, 1, 0, 0, 2, 10, 4, 40, 92, 352, 724, 2680, 14200, 73712, 365596,
+                                                   2279184, 14772512, 95815104, 666090624, 4968057848ull, 39029188884ull};
+// Maior x com número de soluções conhecido na tabela:
+#define X_MAX_CONHECIDO 20
+
+// Tipo de gerador:
+enum TipoDeGerador
+{
+    TOTAL,      // gera todas as soluções.
+    LIMITADO    // gera até n_des soluções.
+};
+
+// Gerador medido:
+struct Gerador
+{
+    std::string nome;   // nome nos relatórios (a pasta do gerador).
+    std::string fonte;  // arquivo-fonte, relativo à raiz do repositório.
+    TipoDeGerador tipo; // total ou limitado.
+    unsigned int x_max; // maior x medido (os geradores antigos são lentos).
+    // Respostas aos prompts do gerador para x e n_des:
+    std::string (*entrada)(unsigned int x, unsigned long long n_des);
+    // Se a busca é completa (a busca local não prova que esgotou as soluções,
+    // então, se n_des excede o total, basta não passar dele):
+    bool completo = true;
+    // Máximo de soluções que o gerador entrega independentemente de n_des (0 se não há):
+    unsigned long long maximo = 0;
+};
+
+// Respostas dos geradores com prompt de centro do tabuleiro (versões 6 e 7 e rascunhos):
+std::string entrada_com_centro(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n0\n";
+}
+std::string entrada_limitada_com_centro(unsigned int x, unsigned long long n_des)
+{
+    return std::to_string(x) + "\n0\n" + std::to_string(n_des) + "\n";
+}
+// Respostas dos geradores que só perguntam x:
+std::string entrada_so_x(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n";
+}
+// Respostas dos geradores que perguntam x e um número de soluções (0 para todas na versão 14):
+std::string entrada_x_e_n(unsigned int x, unsigned long long n_des)
+{
+    return std::to_string(x) + "\n" + std::to_string(n_des) + "\n";
+}
+// Respostas dos geradores aleatórios com semente (fixa, para medições reproduzíveis):
+std::string entrada_com_semente(unsigned int x, unsigned long long n_des)
+{
+    return std::to_string(x) + "\n" + std::to_string(n_des) + "\n42\n";
+}
+// Versão 17 de Gerador+Total: sem pontos de controle:
+std::string entrada_sem_controle(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n0\n0\n";
+}
+// Versão 19 de Gerador+Total: sem rainhas fixas, apenas contagem:
+std::string entrada_cobertura(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n0\n1\n";
+}
+// x: número de possibilidades.
+// Retorna a profundidade dos prefixos usada nos geradores divididos em tarefas ou fragmentos:
+unsigned int profundidade_de_divisao(unsigned int x)
+{
+    return x < 2 ? 1 : 2;
+}
+// Versão 10 de Gerador+Limitado: sem limite de nós por estratégia:
+std::string entrada_estrategias(unsigned int x, unsigned long long n_des)
+{
+    return std::to_string(x) + "\n" + std::to_string(n_des) + "\n0\n";
+}
+// Versão 11 de Gerador+Total: divisão em tarefas, um trabalhador por núcleo:
+std::string entrada_tarefas(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n" + std::to_string(profundidade_de_divisao(x)) + "\n0\n";
+}
+// Versão 12 de Gerador+Total: salva todas as soluções (não só as fundamentais):
+std::string entrada_simetria(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n1\n";
+}
+// Versão 13 de Gerador+Total: contadores de 64 bits:
+std::string entrada_contagem(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n64\n";
+}
+// Versão 16 de Gerador+Total: índice de prefixos de profundidade 2 (o arquivo é
+// apagado antes de cada execução, então é sempre gerado e mapeado):
+std::string entrada_arquivo(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n" + std::to_string(profundidade_de_divisao(x)) + "\n";
+}
+// Versão 18 de Gerador+Total: 4 fragmentos executados localmente, só contando:
+std::string entrada_fragmentos(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n" + std::to_string(profundidade_de_divisao(x)) + "\n4\n2\n0\n";
+}
+// Versão 21 de Gerador+Total: sem estimativa e sem relatórios de progresso:
+std::string entrada_sem_estimativa(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n0\n1\n1\n0\n";
+}
+// Respostas dos geradores que perguntam x e um número de linhas de execução (0 para o número de núcleos):
+std::string entrada_x_e_linhas(unsigned int x, unsigned long long)
+{
+    return std::to_string(x) + "\n0\n";
+}
+// Versão 12 de Gerador+Limitado: uma linha de execução, semente fixa:
+std::string entrada_reparo(unsigned int x, unsigned long long n_des)
+{
+    return std::to_string(x) + "\n" + std::to_string(n_des) + "\n1\n42\n";
+}
+// Versão 13 de Gerador+Limitado: uma busca, semente fixa, reinícios de 1000 nós:
+std::string entrada_portfolio(unsigned int x, unsigned long long n_des)
+{
+    return std::to_string(x) + "\n" + std::to_string(n_des) + "\n1\n42\n1000\n";
+}
+
+// Geradores medidos:
+const std::vector<Gerador> GERADORES = {
+    {"Rascunho/gerador+total+v1",   "Rascunho/rainhas+-+gerador+total+-+v1.cpp",     TOTAL,    8,  entrada_com_centro},
+    {"Rascunho/gerador+total+v2",   "Rascunho/rainhas+-+gerador+total+-+v2.cpp",     TOTAL,    8,  entrada_com_centro},
+    {"Rascunho/gerador+total+v3",   "Rascunho/rainhas+-+gerador+total+-+v3.cpp",     TOTAL,    8,  entrada_com_centro},
+    {"Rascunho/gerador+total+v4",   "Rascunho/rainhas+-+gerador+total+-+v4.cpp",     TOTAL,    8,  entrada_com_centro},
+    {"Gerador+Total/v6",            "Gerador+Total/v6/rainhas.cpp",                 TOTAL,    11, entrada_com_centro},
+    {"Gerador+Total/v7",            "Gerador+Total/v7/rainhas.cpp",                 TOTAL,    11, entrada_com_centro},
+    {"Gerador+Total/v8-1",          "Gerador+Total/v8-1/rainhas.cpp",               TOTAL,    11, entrada_so_x},
+    {"Gerador+Total/v8-2",          "Gerador+Total/v8-2/rainhas.cpp",               TOTAL,    11, entrada_so_x},
+    {"Gerador+Total/v8-3",          "Gerador+Total/v8-3/rainhas.cpp",               TOTAL,    13, entrada_so_x},
+    {"Gerador+Total/v9",            "Gerador+Total/v9/rainhas.cpp",                 TOTAL,    13, entrada_so_x},
+    {"Gerador+Total/v10",           "Gerador+Total/v10/rainhas.cpp",                TOTAL,    15, entrada_so_x},
+    {"Gerador+Total/v11",           "Gerador+Total/v11/rainhas.cpp",                TOTAL,    15, entrada_tarefas},
+    {"Gerador+Total/v12",           "Gerador+Total/v12/rainhas.cpp",                TOTAL,    14, entrada_simetria},
+    {"Gerador+Total/v13",           "Gerador+Total/v13/rainhas.cpp",                TOTAL,    15, entrada_contagem},
+    {"Gerador+Total/v14",           "Gerador+Total/v14/rainhas.cpp",                TOTAL,    14, entrada_x_e_n},
+    {"Gerador+Total/v15",           "Gerador+Total/v15/rainhas.cpp",                TOTAL,    14, entrada_so_x},
+    {"Gerador+Total/v16",           "Gerador+Total/v16/rainhas.cpp",                TOTAL,    14, entrada_arquivo},
+    {"Gerador+Total/v17",           "Gerador+Total/v17/rainhas.cpp",                TOTAL,    15, entrada_sem_controle},
+    {"Gerador+Total/v18",           "Gerador+Total/v18/rainhas.cpp",                TOTAL,    15, entrada_fragmentos},
+    {"Gerador+Total/v19",           "Gerador+Total/v19/rainhas.cpp",                TOTAL,    14, entrada_cobertura},
+    {"Gerador+Total/v21",           "Gerador+Total/v21/rainhas.cpp",                TOTAL,    13, entrada_sem_estimativa},
+    {"Rascunho/gerador+limitado+v2","Rascunho/rainhas+-+gerador+limitado+-+v2.cpp",  LIMITADO, 8,  entrada_limitada_com_centro},
+    {"Rascunho/gerador+limitado+v3","Rascunho/rainhas+-+gerador+limitado+-+v3.cpp",  LIMITADO, 8,  entrada_limitada_com_centro},
+    {"Rascunho/gerador+limitado+v4","Rascunho/rainhas+-+gerador+limitado+-+v4.cpp",  LIMITADO, 8,  entrada_limitada_com_centro},
+    {"Rascunho/gerador+limitado+v5","Rascunho/rainhas+-+gerador+limitado+-+v5.cpp",  LIMITADO, 8,  entrada_limitada_com_centro},
+    {"Gerador+Limitado/v6-1",       "Gerador+Limitado/v6-1/rainhas.cpp",            LIMITADO, 12, entrada_limitada_com_centro},
+    {"Gerador+Limitado/v6-2",       "Gerador+Limitado/v6-2/rainhas.cpp",            LIMITADO, 12, entrada_limitada_com_centro},
+    {"Gerador+Limitado/v7-1",       "Gerador+Limitado/v7-1/rainhas.cpp",            LIMITADO, 12, entrada_limitada_com_centro},
+    {"Gerador+Limitado/v7-2",       "Gerador+Limitado/v7-2/rainhas.cpp",            LIMITADO, 12, entrada_limitada_com_centro},
+    {"Gerador+Limitado/v8-1",       "Gerador+Limitado/v8-1/rainhas.cpp",            LIMITADO, 14, entrada_x_e_n},
+    {"Gerador+Limitado/v8-2",       "Gerador+Limitado/v8-2/rainhas.cpp",            LIMITADO, 14, entrada_com_semente},
+    {"Gerador+Limitado/v9-1",       "Gerador+Limitado/v9-1/rainhas.cpp",            LIMITADO, 20, entrada_x_e_n},
+    {"Gerador+Limitado/v9-2",       "Gerador+Limitado/v9-2/rainhas.cpp",            LIMITADO, 20, entrada_com_semente},
+    {"Gerador+Limitado/v10",        "Gerador+Limitado/v10/rainhas.cpp",             LIMITADO, 14, entrada_estrategias},
+    {"Gerador+Limitado/v11",        "Gerador+Limitado/v11/rainhas.cpp",             LIMITADO, 20, entrada_x_e_linhas, true, 1},
+    {"Gerador+Limitado/v12",        "Gerador+Limitado/v12/rainhas.cpp",             LIMITADO, 20, entrada_reparo, false},
+    {"Gerador+Limitado/v13",        "Gerador+Limitado/v13/rainhas.cpp",             LIMITADO, 20, entrada_portfolio},
+};
+
+// Medição de uma execução:
+struct Execucao
+{
+    bool ok;                    // se o processo terminou normalmente e informou o número de soluções.
+    unsigned long long solucoes;// número de soluções informado.
+    long long nos;              // número de nós informado (-1 se o gerador não informa).
+    double tempo;               // tempo de parede (s), incluindo o início do processo.
+    long pico_rss;              // pico de memória residente (KiB).
+};
+
+// texto: saída de um gerador;
+// chave: texto que precede o número.
+// Retorna o número após a última ocorrência da chave (-1 se não há):
+long long numero_apos(const std::string& texto, const std::string& chave)
+{
+    size_t p = texto.rfind(chave);
+    if(p == std::string::npos)
+    {
+        return -1;
+    }
+    p += chave.size();
+    // Se não começa por um algarismo:
+    if(p >= texto.size() || texto[p] < '0' || texto[p] > '9')
+    {
+        return -1;
+    }
+    return std::stoll(texto.substr(p));
+}
+
+// Apaga os arquivos de trabalho dos geradores (soluções, pontos de controle e
+// fragmentos, todos chamados rainhas-*) deixados na pasta por uma execução
+// anterior, para que cada execução comece do zero:
+void apaga_arquivos_de_trabalho()
+{
+    glob_t G;
+    if(!glob("rainhas-*", 0, NULL, &G))
+    {
+        for(size_t k = 0; k < G.gl_pathc; k++)
+        {
+            unlink(G.gl_pathv[k]);
+        }
+    }
+    globfree(&G);
+}
+
+// executavel: caminho do gerador compilado;
+// entrada   : respostas aos prompts.
+// Executa o gerador e mede tempo, memória e as contagens que ele informa:
+Execucao executa(const std::string& executavel, const std::string& entrada)
+{
+    Execucao e = {false, 0, -1, 0., 0};
+    int para_filho[2], do_filho[2];
+    if(pipe(para_filho) || pipe(do_filho))
+    {
+        std::cerr << "Erro ao criar canais de comunicação." << std::endl;
+        exit(1);
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    if(pid < 0)
+    {
+        std::cerr << "Erro ao criar processo." << std::endl;
+        exit(1);
+    }
+    // Processo filho: liga os canais à entrada e à saída padrão e executa o gerador:
+    if(!pid)
+    {
+        dup2(para_filho[0], 0);
+        dup2(do_filho[1], 1);
+        close(para_filho[0]);
+        close(para_filho[1]);
+        close(do_filho[0]);
+        close(do_filho[1]);
+        execl(executavel.c_str(), executavel.c_str(), (char*)NULL);
+        _exit(127);
+    }
+    close(para_filho[0]);
+    close(do_filho[1]);
+
+    // Envia as respostas e lê toda a saída:
+    if(write(para_filho[1], entrada.data(), entrada.size()) < 0)
+    {
+        // O gerador terminou antes de ler; o resultado fica como falha.
+    }
+    close(para_filho[1]);
+    std::string saida;
+    char bloco[1 << 16];
+    for(ssize_t n; (n = read(do_filho[0], bloco, sizeof(bloco))) > 0;)
+    {
+        saida.append(bloco, n);
+    }
+    close(do_filho[0]);
+
+    // Espera o processo e obtém o seu uso de recursos:
+    int estado;
+    struct rusage uso;
+    wait4(pid, &estado, 0, &uso);
+    e.tempo = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+    e.pico_rss = uso.ru_maxrss;
+
+    // Número de soluções (os rascunhos mais antigos usam "é:") e de nós:
+    long long n = numero_apos(saida, "Rainhas Padrão: ");
+    if(n < 0)
+    {
+        n = numero_apos(saida, "Rainhas Padrão é: ");
+    }
+    e.nos = numero_apos(saida, "nós visitados: ");
+    e.ok = WIFEXITED(estado) && !WEXITSTATUS(estado) && n >= 0;
+    e.solucoes = n >= 0 ? n : 0;
+    return e;
+}
+
+// V: valores (não vazio).
+// Retorna a mediana:
+double mediana(std::vector<double> V)
+{
+    std::sort(V.begin(), V.end());
+    size_t m = V.size()/2;
+    return V.size() % 2 ? V[m] : (V[m-1] + V[m])/2.;
+}
+
+// Escreve um número real em JSON (os não finitos viram null):
+std::string json(double v)
+{
+    if(!(v == v) || v > 1e308 || v < -1e308)
+    {
+        return "null";
+    }
+    std::ostringstream s;
+    s.precision(9);
+    s << v;
+    return s.str();
+}
+
+// V: lista separada por vírgulas.
+// Retorna os naturais da lista:
+std::vector<unsigned long long> lista_de_naturais(const std::string& V)
+{
+    std::vector<unsigned long long> R;
+    std::stringstream s(V);
+    std::string item;
+    while(std::getline(s, item, ','))
+    {
+        if(!item.empty())
+        {
+            R.push_back(std::stoull(item));
+        }
+    }
+    return R;
+}
+
+int main(int argc, char** argv)
+{
+    // Um gerador que termina antes de ler a entrada fecha o canal; sem isto,
+    // a escrita no canal mataria o medidor em vez de a execução ficar como falha:
+    signal(SIGPIPE, SIG_IGN);
+
+    // Grade de medição:
+    unsigned int x_min, x_max, n_rep;
+    std::vector<unsigned long long> N_DES;
+    try
+    {
+        x_min = argc > 2 ? std::stoul(argv[1]) : 4;
+        x_max = argc > 2 ? std::stoul(argv[2]) : 10;
+        n_rep = argc > 3 ? std::stoul(argv[3]) : 5;
+        N_DES = lista_de_naturais(argc > 4 ? argv[4] : "1,10,100");
+    } catch(const std::exception&)
+    {
+        std::cerr << "Uso: " << argv[0] << " [x_mínimo x_máximo [repetições [n_des,n_des,... [saída.json]]]]" << std::endl;
+        return 1;
+    }
+    std::string nome_da_saida = argc > 5 ? argv[5] : "desempenho.json";
+    if(!x_min || x_max < x_min || x_max > X_MAX_CONHECIDO || !n_rep || N_DES.empty())
+    {
+        std::cout << "Erro. Use 1 <= x_mínimo <= x_máximo <= " << X_MAX_CONHECIDO
+                    << ", repetições não nulas e uma lista de n_des não vazia." << std::endl;
+        return 0;
+    }
+
+    // Compila todos os geradores com as mesmas opções:
+    mkdir("bin", 0755);
+    std::vector<bool> compilou;
+    for(auto& G : GERADORES)
+    {
+        std::string executavel = "bin/" + std::to_string(&G - GERADORES.data()) + ".exe";
+        std::string comando = "g++ \"../" + G.fonte + "\" -o " + executavel + " -O2 -march=native -pthread -w 2> /dev/null";
+        std::cout << "Compilando " << G.nome << "..." << std::endl;
+        compilou.push_back(!std::system(comando.c_str()));
+        if(!compilou.back())
+        {
+            std::cout << "    Não compila; o gerador não será medido." << std::endl;
+        }
+    }
+
+    // Se algum gerador errou o número de soluções:
+    bool algum_erro = false;
+    std::ostringstream J;
+    J << "{\n  \"x_minimo\": " << x_min << ", \"x_maximo\": " << x_max << ", \"repeticoes\": " << n_rep
+        << ",\n  \"resultados\": [";
+    bool primeiro = true;
+
+    // Para todos os geradores, todos os x e (nos limitados) todos os n_des:
+    for(auto& G : GERADORES)
+    {
+        std::string executavel = "bin/" + std::to_string(&G - GERADORES.data()) + ".exe";
+        // Se não compilou, só registra:
+        if(!compilou[&G - GERADORES.data()])
+        {
+            J << (primeiro ? "\n" : ",\n") << "    {\"gerador\": \"" << G.nome << "\", \"compilou\": false}";
+            primeiro = false;
+            continue;
+        }
+        for(unsigned int x = x_min; x <= x_max && x <= G.x_max; x++)
+        {
+            std::vector<unsigned long long> grade = G.tipo == TOTAL ? std::vector<unsigned long long>{0} : N_DES;
+            for(auto n_des : grade)
+            {
+                // Número de soluções esperado:
+                unsigned long long esperado = SOLUCOES_CONHECIDAS[x];
+                if(G.tipo == LIMITADO && n_des < esperado)
+                {
+                    esperado = n_des;
+                }
+                if(G.maximo && G.maximo < esperado)
+                {
+                    esperado = G.maximo;
+                }
+
+                // Repete a execução:
+                std::vector<double> T, M;
+                Execucao ultima = {false, 0, -1, 0., 0};
+                bool correto = true;
+                for(unsigned int r = 0; r < n_rep; r++)
+                {
+                    apaga_arquivos_de_trabalho();
+                    ultima = executa(executavel, G.entrada(x, n_des));
+                    correto = correto && ultima.ok && (ultima.solucoes == esperado
+                                || (!G.completo && esperado == SOLUCOES_CONHECIDAS[x] && ultima.solucoes <= esperado));
+                    T.push_back(ultima.tempo);
+                    M.push_back(double(ultima.pico_rss));
+                }
+                algum_erro = algum_erro || !correto;
+
+                // Estatísticas do tempo: mediana, extremos e desvio absoluto mediano:
+                double t_med = mediana(T);
+                std::vector<double> D;
+                for(double t : T)
+                {
+                    D.push_back(t > t_med ? t-t_med : t_med-t);
+                }
+                double t_min = *std::min_element(T.begin(), T.end());
+                double t_max = *std::max_element(T.begin(), T.end());
+
+                std::cout << G.nome << ", x = " << x;
+                if(G.tipo == LIMITADO)
+                {
+                    std::cout << ", n_des = " << n_des;
+                }
+                std::cout << ": " << ultima.solucoes << " soluções (esperadas " << esperado << ") "
+                            << (correto ? "ok" : "ERRO") << ", mediana " << t_med << " s, pico "
+                            << long(mediana(M)) << " KiB." << std::endl;
+
+                J << (primeiro ? "\n" : ",\n") << "    {\"gerador\": \"" << G.nome << "\", \"x\": " << x
+                    << ", \"n_des\": " << (G.tipo == LIMITADO ? std::to_string(n_des) : "null")
+                    << ", \"solucoes\": " << ultima.solucoes << ", \"esperado\": " << esperado
+                    << ", \"correto\": " << (correto ? "true" : "false")
+                    << ", \"tempo_s\": {\"mediana\": " << json(t_med) << ", \"minimo\": " << json(t_min)
+                    << ", \"maximo\": " << json(t_max) << ", \"desvio_absoluto_mediano\": " << json(mediana(D)) << "}"
+                    << ", \"nos\": " << (ultima.nos >= 0 ? std::to_string(ultima.nos) : "null")
+                    << ", \"pico_rss_kib\": {\"mediana\": " << json(mediana(M))
+                    << ", \"maximo\": " << json(*std::max_element(M.begin(), M.end())) << "}"
+                    << ", \"solucoes_por_s\": " << json(t_med > 0 ? ultima.solucoes/t_med : 0.) << "}";
+                primeiro = false;
+            }
+        }
+    }
+    J << "\n  ]\n}\n";
+    apaga_arquivos_de_trabalho();
+
+    // Grava os resultados:
+    std::ofstream arquivo(nome_da_saida);
+    arquivo << J.str();
+    if(!arquivo)
+    {
+        std::cerr << "Erro ao gravar " << nome_da_saida << "." << std::endl;
+        return 1;
+    }
+    std::cout << "Resultados gravados em " << nome_da_saida << "." << std::endl;
+    return algum_erro ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "../../Biblioteca/ordem.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou acima do suportado:
+    if(!x || x > X_MAX_DE_ORDEM)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX_DE_ORDEM << "." << std::endl;
+        return 0;
+    }
+
+    // Quantidade de soluções desejadas:
+    unsigned long long n_des;
+    std::cout << "Entre com um número de soluções desejado (0 para todas): ";
+    std::cin >> n_des;
+
+    // Limite de nós de cada estratégia:
+    unsigned long long limite;
+    std::cout << "Entre com um limite de nós por estratégia (0 para nenhum): ";
+    std::cin >> limite;
+
+    // Estratégias comparadas:
+    std::vector<std::unique_ptr<EstrategiaDeOrdem>> estrategias;
+    estrategias.emplace_back(new EstrategiaDeOrdem());
+    estrategias.emplace_back(new OrdemDoCentro(x));
+    estrategias.emplace_back(new OrdemPorDistancia(2));
+    estrategias.emplace_back(new ComMRV<EstrategiaDeOrdem>());
+    estrategias.emplace_back(new ComMRV<OrdemDoCentro>(x));
+    estrategias.emplace_back(new ComMRV<OrdemPorDistancia>(2));
+
+    // Para todas as estratégias:
+    for(auto& O : estrategias)
+    {
+        // Número de soluções e de falsas soluções:
+        unsigned long long n_sol = 0, n_f_sol = 0;
+        // Valida as soluções e para ao atingir o número desejado:
+        SumidouroDeFuncao s([&](unsigned int x, const unsigned int* S)
+        {
+            n_sol++;
+            // Se não for de fato solução:
+            if(!eh_solucao_de_bits(x, S))
+            {
+                n_f_sol++;
+            }
+            return !n_des || n_sol < n_des;
+        });
+
+        // Número de nós visitados:
+        unsigned long long nos;
+        auto inicio = std::chrono::steady_clock::now();
+        gera_solucoes_com_ordem(x, *O, s, &nos, limite);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+
+        std::cout << "Estratégia " << O->nome() << ":" << std::endl;
+        std::cout << "    Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+        std::cout << "    Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+        std::cout << "    Número de nós visitados: " << nos << (limite && nos == limite ? " (limite atingido)" : "") << std::endl;
+        std::cout << "    Tempo: " << t << " s." << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -pthread
+
+#include <iostream>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../Biblioteca/arquivo.hpp"
+
+// Maior número de possibilidades suportado (coordenadas de 32 bits no arquivo):
+#define X_MAX 4294967295ull
+// Coordenadas por unidade de divisão entre linhas de execução (64 coordenadas
+// de b bits ocupam exatamente b palavras, então os trechos não dividem palavras):
+#define COORDENADAS_POR_UNIDADE 64
+
+// x: número de possibilidades de valores para as
+//    coordenadas de uma casa de um (2, x)-tabuleiro.
+// Retorna se há solução (só não há para x = 2 e x = 3):
+inline bool tem_solucao(unsigned long long x)
+{
+    return x != 2 && x != 3;
+}
+
+// x: número de possibilidades (com solução);
+// i: índice da posição.
+// Retorna a coordenada da (i+1)-ésima rainha da solução explícita: as colunas
+// pares (2, 4, ...) seguidas das ímpares (1, 3, ...), contadas a partir de 1,
+// com os ajustes conhecidos para x ≡ 2 e x ≡ 3 (mód 6). Cada coordenada é
+// calculada de forma independente, em O(1):
+inline unsigned long long coordenada_construtiva(unsigned long long x, unsigned long long i)
+{
+    // Número de colunas pares:
+    unsigned long long p = x/2;
+    // Coluna (contada a partir de 1):
+    unsigned long long c;
+    switch(x % 6)
+    {
+        case 2:
+            // Pares: 2, 4, ..., x; ímpares: 3, 1, 7, 9, ..., x-1, 5:
+            if(i < p)
+            {
+                c = 2*(i+1);
+            } else
+            {
+                unsigned long long j = i-p;
+                c = j == 0 ? 3 : (j == 1 ? 1 : (j == p-1 ? 5 : 2*j+3));
+            }
+            break;
+        case 3:
+            // Pares: 4, 6, ..., x-1, 2; ímpares: 5, 7, ..., x, 1, 3:
+            if(i < p)
+            {
+                c = i == p-1 ? 2 : 2*(i+2);
+            } else
+            {
+                unsigned long long j = i-p;
+                c = j == p ? 3 : (j == p-1 ? 1 : 2*j+5);
+            }
+            break;
+        default:
+            // Pares: 2, 4, ...; ímpares: 1, 3, ...:
+            c = i < p ? 2*(i+1) : 2*(i-p)+1;
+            break;
+    }
+    return c-1;
+}
+
+// x      : número de possibilidades;
+// b      : bits por coordenada;
+// W      : palavras dos registros;
+// q0, q1 : intervalo de posições do trecho (q0 múltiplo de COORDENADAS_POR_UNIDADE).
+// Empacota as coordenadas do trecho nas suas palavras (que nenhum outro trecho escreve):
+void preenche_trecho(unsigned long long x, unsigned int b, uint64_t* W, unsigned long long q0, unsigned long long q1)
+{
+    // Palavra atual (o trecho começa em fronteira de palavra):
+    uint64_t w = q0*b/64;
+    // Bits ainda não escritos e seu número:
+    uint64_t acumulador = 0;
+    unsigned int n_bits = 0;
+    for(unsigned long long q = q0; q < q1; q++)
+    {
+        uint64_t v = coordenada_construtiva(x, q);
+        acumulador |= v << n_bits;
+        // Se a coordenada completou a palavra:
+        if(n_bits + b >= 64)
+        {
+            unsigned int usados = 64 - n_bits;
+            W[w++] = acumulador;
+            // Guarda os bits que sobraram:
+            acumulador = usados < b ? v >> usados : 0;
+            n_bits = n_bits + b - 64;
+        } else
+        {
+            n_bits += b;
+        }
+    }
+    // Escreve a última palavra incompleta (só no último trecho):
+    if(n_bits)
+    {
+        W[w] = acumulador;
+    }
+}
+
+// L: arquivo de soluções mapeado.
+// Valida a primeira solução do arquivo em O(x), marcando colunas,
+// diagonais e antidiagonais em mapas de bits:
+bool valida_solucao_mapeada(const LeitorDeArquivo& L)
+{
+    unsigned long long x = L.x();
+    std::vector<uint64_t> colunas((x+63)/64, 0), diagonais((2*x+63)/64, 0), antidiagonais((2*x+63)/64, 0);
+    for(unsigned long long i = 0; i < x; i++)
+    {
+        unsigned long long v = L.coordenada(0, i);
+        // Se a coordenada está fora do tabuleiro:
+        if(v >= x)
+        {
+            return false;
+        }
+        unsigned long long d = v+i, a = v+x-1-i;
+        // Se a coluna, a diagonal ou a antidiagonal já está ocupada:
+        if(((colunas[v/64] >> (v%64)) | (diagonais[d/64] >> (d%64)) | (antidiagonais[a/64] >> (a%64))) & 1)
+        {
+            return false;
+        }
+        colunas[v/64] |= uint64_t(1) << (v%64);
+        diagonais[d/64] |= uint64_t(1) << (d%64);
+        antidiagonais[a/64] |= uint64_t(1) << (a%64);
+    }
+    return true;
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned long long x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou acima do suportado:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+    // Se não há solução:
+    if(!tem_solucao(x))
+    {
+        std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: 0" << std::endl;
+        return 0;
+    }
+
+    // Número de linhas de execução:
+    unsigned int n_t;
+    std::cout << "Entre com um número de linhas de execução (0 para o número de núcleos): ";
+    std::cin >> n_t;
+    if(!n_t)
+    {
+        n_t = std::thread::hardware_concurrency();
+        n_t = n_t ? n_t : 1;
+    }
+
+    // Arquivo da solução (com nome próprio, para não ser tomado pelo arquivo
+    // de todas as soluções do tabuleiro, que outras versões guardam em rainhas-<x>.bin):
+    std::string nome = "rainhas-" + std::to_string(x) + "-construtiva.bin";
+    auto inicio = std::chrono::steady_clock::now();
+    {
+        EscritorMapeado E;
+        if(!E.abre(nome.c_str(), unsigned(x), 1))
+        {
+            return 0;
+        }
+        unsigned int b = bits_por_coordenada(unsigned(x));
+        // Posições por trecho (em unidades inteiras):
+        unsigned long long unidades = (x + COORDENADAS_POR_UNIDADE-1)/COORDENADAS_POR_UNIDADE;
+        unsigned long long por_trecho = ((unidades + n_t-1)/n_t)*COORDENADAS_POR_UNIDADE;
+        // Preenche os trechos em paralelo:
+        std::vector<std::thread> trabalhadores;
+        for(unsigned long long q0 = 0; q0 < x; q0 += por_trecho)
+        {
+            unsigned long long q1 = q0 + por_trecho < x ? q0 + por_trecho : x;
+            trabalhadores.emplace_back(preenche_trecho, x, b, E.registros(), q0, q1);
+        }
+        for(auto& t : trabalhadores)
+        {
+            t.join();
+        }
+    }
+    double t_geracao = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+
+    // Mapeia o arquivo escrito e valida a solução:
+    inicio = std::chrono::steady_clock::now();
+    LeitorDeArquivo L;
+    if(!L.abre(nome.c_str()))
+    {
+        return 0;
+    }
+    bool valida = valida_solucao_mapeada(L);
+    double t_validacao = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+
+    // Imprime o início da solução (no máximo 16 coordenadas):
+    std::cout << "Solução em " << nome << ": [";
+    for(unsigned long long i = 0; i < x && i < 16; i++)
+    {
+        std::cout << L.coordenada(0, i) << (i+1 < x ? ", " : "");
+    }
+    std::cout << (x > 16 ? "...]" : "]") << std::endl;
+    std::cout << "Número de sequências geradas que não são solução do problema: " << !valida << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << valida << std::endl;
+    std::cout << "Tempo de geração: " << t_geracao << " s; tempo de validação: " << t_validacao << " s." << std::endl;
+    return 0;
+}
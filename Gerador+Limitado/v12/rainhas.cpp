@@ -0,0 +1,80 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -pthread
+
+#include <iostream>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../../Biblioteca/conflitos_minimos.hpp"
+#include "../../Biblioteca/sumidouro.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo:
+    if(!x)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        return 0;
+    }
+
+    // Quantidade de soluções distintas desejadas:
+    unsigned long long n_des;
+    std::cout << "Entre com um número de soluções desejado: ";
+    std::cin >> n_des;
+
+    // Número de linhas de execução:
+    unsigned int n_t;
+    std::cout << "Entre com um número de linhas de execução (0 para o número de núcleos): ";
+    std::cin >> n_t;
+
+    // Semente das cadeias:
+    uint64_t semente;
+    std::cout << "Entre com uma semente (0 para aleatória): ";
+    std::cin >> semente;
+    if(!semente)
+    {
+        semente = (uint64_t(std::random_device()()) << 32) | std::random_device()();
+        std::cout << "Semente usada: " << semente << std::endl;
+    }
+
+    // Soluções encontradas:
+    std::vector<std::vector<unsigned int>> R;
+    SumidouroDeFuncao s([&](unsigned int x, const unsigned int* S)
+    {
+        R.emplace_back(S, S+x);
+        return true;
+    });
+
+    auto inicio = std::chrono::steady_clock::now();
+    gera_solucoes_por_reparo(x, n_des, n_t, semente, s);
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+
+    // Número de falsas soluções:
+    unsigned long long n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(auto& S : R)
+    {
+        // Se não for de fato solução:
+        if(S.size() != x || !eh_solucao_de_bits(x, S.data()))
+        {
+            n_f_sol++;
+        }
+    }
+    // Número de soluções repetidas (conferência da deduplicação):
+    std::set<std::vector<unsigned int>> distintas(R.begin(), R.end());
+
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções repetidas: " << R.size()-distintas.size() << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << R.size()-n_f_sol << std::endl;
+    std::cout << "Tempo: " << t << " s." << std::endl;
+    return 0;
+}
@@ -0,0 +1,586 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -march=native -pthread
+// Observação: -march=native habilita AVX2 (se disponível) na
+// busca pela primeira possibilidade livre de um conjunto de bits.
+
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../../Biblioteca/aleatorio.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+
+// Número de bits de uma palavra:
+#define BITS_POR_PALAVRA 64
+// Maior número de palavras de um conjunto de bits:
+#define PALAVRAS_MAX 64
+// Maior número de possibilidades suportado:
+#define X_MAX (BITS_POR_PALAVRA*PALAVRAS_MAX)
+
+// Conjunto de W palavras, em que o bit b representa a possibilidade b:
+template<unsigned int W>
+struct ConjuntoDeBits
+{
+    uint64_t p[W];
+
+    // Esvazia o conjunto:
+    void zera()
+    {
+        for(unsigned int w = 0; w < W; w++)
+        {
+            p[w] = 0;
+        }
+    }
+
+    // x: número de possibilidades (bits menos significativos) a ligar.
+    void preenche(unsigned int x)
+    {
+        for(unsigned int w = 0; w < W; w++)
+        {
+            // Se a palavra está inteira abaixo de x:
+            if((w+1)*BITS_POR_PALAVRA <= x)
+            {
+                p[w] = ~uint64_t(0);
+            } else if(w*BITS_POR_PALAVRA < x)
+            { // Senão, se a palavra contém o limite:
+                p[w] = (uint64_t(1) << (x - w*BITS_POR_PALAVRA)) - 1;
+            } else
+            { // Senão, a palavra está inteira acima de x:
+                p[w] = 0;
+            }
+        }
+    }
+
+    // b: possibilidade a inserir.
+    void liga(unsigned int b)
+    {
+        p[b/BITS_POR_PALAVRA] |= uint64_t(1) << (b%BITS_POR_PALAVRA);
+    }
+
+    // b: possibilidade a remover.
+    void desliga(unsigned int b)
+    {
+        p[b/BITS_POR_PALAVRA] &= ~(uint64_t(1) << (b%BITS_POR_PALAVRA));
+    }
+
+    // w: índice de palavra do resultado;
+    // q: deslocamento em palavras;
+    // s: deslocamento em bits dentro da palavra.
+    // Retorna a w-ésima palavra do conjunto deslocado q*64+s bits para
+    // possibilidades maiores (os bits atravessam a fronteira das palavras).
+    uint64_t palavra_a_esquerda(unsigned int w, unsigned int q, unsigned int s) const
+    {
+        // Se a palavra de origem está antes do início:
+        if(w < q)
+        {
+            return 0;
+        }
+        uint64_t v = p[w-q] << s;
+        // Se há bits vindos da palavra anterior:
+        if(s && w > q)
+        {
+            v |= p[w-q-1] >> (BITS_POR_PALAVRA-s);
+        }
+        return v;
+    }
+
+    // w: índice de palavra do resultado;
+    // q: deslocamento em palavras;
+    // s: deslocamento em bits dentro da palavra.
+    // Retorna a w-ésima palavra do conjunto deslocado q*64+s bits para
+    // possibilidades menores (os bits atravessam a fronteira das palavras).
+    uint64_t palavra_a_direita(unsigned int w, unsigned int q, unsigned int s) const
+    {
+        // Se a palavra de origem está após o fim:
+        if(w+q >= W)
+        {
+            return 0;
+        }
+        uint64_t v = p[w+q] >> s;
+        // Se há bits vindos da palavra seguinte:
+        if(s && w+q+1 < W)
+        {
+            v |= p[w+q+1] << (BITS_POR_PALAVRA-s);
+        }
+        return v;
+    }
+
+    // n: deslocamento em bits para possibilidades maiores.
+    ConjuntoDeBits desloca_a_esquerda(unsigned int n) const
+    {
+        ConjuntoDeBits r;
+        for(unsigned int w = 0; w < W; w++)
+        {
+            r.p[w] = palavra_a_esquerda(w, n/BITS_POR_PALAVRA, n%BITS_POR_PALAVRA);
+        }
+        return r;
+    }
+
+    // n: deslocamento em bits para possibilidades menores.
+    ConjuntoDeBits desloca_a_direita(unsigned int n) const
+    {
+        ConjuntoDeBits r;
+        for(unsigned int w = 0; w < W; w++)
+        {
+            r.p[w] = palavra_a_direita(w, n/BITS_POR_PALAVRA, n%BITS_POR_PALAVRA);
+        }
+        return r;
+    }
+
+    // Retorna a menor possibilidade do conjunto ou -1 se vazio:
+    int primeiro() const
+    {
+        // Índice de palavra:
+        unsigned int w = 0;
+#if defined(__AVX2__)
+        // Salta blocos de 4 palavras nulas com um único teste vetorial:
+        for(; w+4 <= W; w += 4)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(p+w));
+            // Se o bloco tem algum bit ligado:
+            if(!_mm256_testz_si256(v, v))
+            {
+                break;
+            }
+        }
+#endif
+        // Procura a primeira palavra não nula (do bloco encontrado em diante):
+        for(; w < W; w++)
+        {
+            if(p[w])
+            {
+                // Retorna o índice do bit (contagem de zeros à direita):
+                return int(w*BITS_POR_PALAVRA + __builtin_ctzll(p[w]));
+            }
+        }
+        return -1;
+    }
+
+    // Retorna se o conjunto é vazio:
+    bool vazio() const
+    {
+        return primeiro() < 0;
+    }
+
+    // Retorna o número de possibilidades do conjunto:
+    unsigned int quantidade() const
+    {
+        unsigned int n = 0;
+        for(unsigned int w = 0; w < W; w++)
+        {
+            n += __builtin_popcountll(p[w]);
+        }
+        return n;
+    }
+
+    // k: ordem da possibilidade desejada (a partir de zero).
+    // Retorna a (k+1)-ésima menor possibilidade do conjunto ou -1 se não existe:
+    int n_esima(unsigned int k) const
+    {
+        // Para todas as palavras:
+        for(unsigned int w = 0; w < W; w++)
+        {
+            // Número de possibilidades da palavra:
+            unsigned int n = __builtin_popcountll(p[w]);
+            // Se a possibilidade está em outra palavra:
+            if(k >= n)
+            {
+                // Desconta as possibilidades da palavra:
+                k -= n;
+                continue;
+            }
+            // Descarta as k menores possibilidades da palavra:
+            uint64_t v = p[w];
+            for(; k; k--)
+            {
+                v &= v-1;
+            }
+            // Retorna o índice do bit restante de menor ordem:
+            return int(w*BITS_POR_PALAVRA + __builtin_ctzll(v));
+        }
+        return -1;
+    }
+};
+
+// Estrutura de estado de uma profundidade da busca:
+template<unsigned int W>
+struct EstadoDeBits
+{
+    ConjuntoDeBits<W> colunas;       // possibilidades usadas por rainhas anteriores.
+    ConjuntoDeBits<W> diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    ConjuntoDeBits<W> antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    ConjuntoDeBits<W> livres;        // possibilidades ainda não testadas na posição.
+};
+
+// omega    : possibilidades de coordenadas;
+// e        : estado de uma posição;
+// m        : distância da posição do estado até a posição verificada.
+// Retorna se a posição a m posições do estado ainda tem possibilidade
+// (equivale a não zerar o espaço de possibilidades da versão 8):
+template<unsigned int W>
+bool tem_possibilidade(const ConjuntoDeBits<W>& omega, const EstadoDeBits<W>& e, unsigned int m)
+{
+    // Deslocamentos em palavras e em bits:
+    unsigned int q = m/BITS_POR_PALAVRA;
+    unsigned int s = m%BITS_POR_PALAVRA;
+    // Para todas as palavras:
+    for(unsigned int w = 0; w < W; w++)
+    {
+        // Possibilidades atacadas na posição verificada:
+        uint64_t atacadas = e.colunas.p[w] | e.diagonais.palavra_a_esquerda(w, q, s)
+                                | e.antidiagonais.palavra_a_direita(w, q, s);
+        // Se sobra possibilidade:
+        if(omega.p[w] & ~atacadas)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// k: índice do termo (a partir de 1).
+// Retorna o k-ésimo termo da sequência de Luby (1, 1, 2, 1, 1, 2, 4, 1, ...),
+// que multiplica o limite de nós de cada reinício:
+unsigned long long luby(unsigned long long k)
+{
+    while(true)
+    {
+        // Menor n tal que k <= 2^n - 1:
+        unsigned int n = 1;
+        for(; (1ull << n) - 1 < k; n++);
+        // Se k fecha um bloco, o termo é 2^(n-1):
+        if(k == (1ull << n) - 1)
+        {
+            return 1ull << (n-1);
+        }
+        // Senão, repete o bloco anterior:
+        k -= (1ull << (n-1)) - 1;
+    }
+}
+
+// Estado compartilhado pelas buscas do portfólio:
+struct Portfolio
+{
+    unsigned long long n_des;                   // número de soluções distintas desejadas.
+    std::set<std::vector<unsigned int>> vistas; // soluções distintas encontradas.
+    std::mutex trava;                           // exclusão mútua sobre as soluções.
+    std::atomic<bool> parar;                    // sinal de cancelamento para todas as buscas.
+    int vencedora;                              // busca que completou as soluções (-1 se nenhuma).
+};
+
+// x: número de possibilidades;
+// S: solução encontrada;
+// P: portfólio;
+// t: índice da busca.
+// Acrescenta a solução ao conjunto compartilhado e, se completou
+// as soluções desejadas, cancela todas as buscas:
+void entrega_solucao(unsigned int x, const unsigned int* S, Portfolio& P, int t)
+{
+    std::lock_guard<std::mutex> guarda(P.trava);
+    // Se outra busca já completou as soluções:
+    if(P.parar.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    P.vistas.insert(std::vector<unsigned int>(S, S+x));
+    if(P.vistas.size() >= P.n_des)
+    {
+        P.vencedora = t;
+        P.parar = true;
+    }
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// gerador  : gerador aleatório da busca;
+// limite   : número máximo de nós da busca (0 para nenhum);
+// P        : portfólio;
+// t        : índice da busca;
+// nos      : número de nós visitados (acumulado).
+// Busca em profundidade aleatória (a da versão 9-2) que entrega as soluções
+// ao portfólio. Retorna verdadeiro se esgotou a árvore de busca e falso se
+// atingiu o limite de nós ou foi cancelada:
+template<unsigned int W>
+bool busca_em_palavras(unsigned int x, Xoshiro256& gerador, unsigned long long limite, Portfolio& P, int t,
+                        unsigned long long* nos)
+{
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    ConjuntoDeBits<W> omega;
+    omega.preenche(x);
+
+    // Estados de cada posição:
+    std::vector<EstadoDeBits<W>> E(x);
+
+    // Solução parcial:
+    std::vector<unsigned int> S(x);
+
+    // Inicia a primeira posição com todas as possibilidades:
+    E[0].colunas.zera();
+    E[0].diagonais.zera();
+    E[0].antidiagonais.zera();
+    E[0].livres = omega;
+
+    // Índice de profundidade e nós desta busca:
+    unsigned int i = 0;
+    unsigned long long n = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se outra busca completou as soluções ou atingiu o limite de nós:
+        if(P.parar.load(std::memory_order_relaxed) || (limite && n == limite))
+        {
+            *nos += n;
+            return false;
+        }
+
+        // Número de possibilidades livres da posição atual:
+        unsigned int n_livres = E[i].livres.quantidade();
+        // Sorteia uma das possibilidades livres:
+        int b = n_livres ? E[i].livres.n_esima(gerador.sorteia(n_livres)) : -1;
+
+        // Se esgotou as possibilidades da posição atual:
+        if(b < 0)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                *nos += n;
+                return true;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Marca a possibilidade como testada:
+        E[i].livres.desliga(b);
+        // Salva a coordenada na solução parcial:
+        S[i] = b;
+        n++;
+
+        // Se completou uma solução:
+        if(i == x-1)
+        {
+            entrega_solucao(x, S.data(), P, t);
+            continue;
+        }
+
+        // Estado da posição seguinte:
+        EstadoDeBits<W>& e = E[i+1];
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        e.colunas = E[i].colunas;
+        e.colunas.liga(b);
+        e.diagonais = E[i].diagonais;
+        e.diagonais.liga(b);
+        e.diagonais = e.diagonais.desloca_a_esquerda(1);
+        e.antidiagonais = E[i].antidiagonais;
+        e.antidiagonais.liga(b);
+        e.antidiagonais = e.antidiagonais.desloca_a_direita(1);
+        // Possibilidades não atacadas na posição seguinte:
+        for(unsigned int w = 0; w < W; w++)
+        {
+            e.livres.p[w] = omega.p[w] & ~(e.colunas.p[w] | e.diagonais.p[w] | e.antidiagonais.p[w]);
+        }
+
+        // Se zerou as possibilidades da posição seguinte:
+        if(e.livres.vazio())
+        {
+            continue;
+        }
+
+        // Bandeira para sinalizar se alguma posição
+        // posterior teve as possibilidades zeradas:
+        bool zerou = false;
+        // Para todas as profundidades além da seguinte:
+        for(unsigned int m = 1; m <= (x-1)-(i+1); m++)
+        {
+            // Se a posição não tem mais possibilidades:
+            if(!tem_possibilidade(omega, e, m))
+            {
+                zerou = true;
+                break;
+            }
+        }
+
+        // Se não zerou as possibilidades de alguma posição:
+        if(!zerou)
+        {
+            // Avança para a posição seguinte:
+            i++;
+        }
+    }
+}
+
+// Estatísticas de uma busca do portfólio:
+struct Estatisticas
+{
+    unsigned long long reinicios; // número de buscas iniciadas.
+    unsigned long long nos;       // número de nós visitados.
+};
+
+// x        : número de possibilidades;
+// semente  : semente da busca;
+// unidade  : nós por unidade da sequência de Luby (0 para não reiniciar);
+// P        : portfólio;
+// t        : índice da busca;
+// est      : estatísticas da busca.
+// Reinicia a busca com limites de nós unidade*luby(k) até que o portfólio
+// seja cancelado. Se alguma busca esgota a árvore, todas as soluções já
+// foram entregues e o portfólio é cancelado:
+template<unsigned int W>
+void executa_busca(unsigned int x, uint64_t semente, unsigned long long unidade, Portfolio* P, int t, Estatisticas* est)
+{
+    Xoshiro256 gerador(semente);
+    for(unsigned long long k = 1; !P->parar.load(std::memory_order_relaxed); k++)
+    {
+        est->reinicios++;
+        if(busca_em_palavras<W>(x, gerador, unidade ? unidade*luby(k) : 0, *P, t, &est->nos))
+        {
+            P->parar = true;
+        }
+    }
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// semente  : semente da primeira busca (a busca t usa semente+t);
+// unidade  : nós por unidade da sequência de Luby (0 para não reiniciar);
+// P        : portfólio;
+// est      : estatísticas de cada busca (uma por linha de execução).
+// Lança as buscas do portfólio, uma por linha de execução, e espera todas:
+template<unsigned int W>
+void executa_portfolio_em_palavras(unsigned int x, uint64_t semente, unsigned long long unidade, Portfolio& P,
+                                    std::vector<Estatisticas>& est)
+{
+    std::vector<std::thread> trabalhadores;
+    for(unsigned int t = 0; t < est.size(); t++)
+    {
+        trabalhadores.emplace_back(executa_busca<W>, x, semente+t, unidade, &P, int(t), &est[t]);
+    }
+    for(auto& t : trabalhadores)
+    {
+        t.join();
+    }
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// semente  : semente da primeira busca;
+// unidade  : nós por unidade da sequência de Luby (0 para não reiniciar);
+// P        : portfólio;
+// est      : estatísticas de cada busca.
+void executa_portfolio(unsigned int x, uint64_t semente, unsigned long long unidade, Portfolio& P,
+                        std::vector<Estatisticas>& est)
+{
+    // Se não deseja solução:
+    if(!P.n_des)
+    {
+        return;
+    }
+
+    // Número de palavras necessárias:
+    unsigned int n_palavras = (x+BITS_POR_PALAVRA-1)/BITS_POR_PALAVRA;
+
+    // Escolhe a menor instância que comporta as possibilidades:
+    if(n_palavras <= 1)       executa_portfolio_em_palavras<1>(x, semente, unidade, P, est);
+    else if(n_palavras <= 2)  executa_portfolio_em_palavras<2>(x, semente, unidade, P, est);
+    else if(n_palavras <= 4)  executa_portfolio_em_palavras<4>(x, semente, unidade, P, est);
+    else if(n_palavras <= 8)  executa_portfolio_em_palavras<8>(x, semente, unidade, P, est);
+    else if(n_palavras <= 16) executa_portfolio_em_palavras<16>(x, semente, unidade, P, est);
+    else if(n_palavras <= 32) executa_portfolio_em_palavras<32>(x, semente, unidade, P, est);
+    else if(n_palavras <= 64) executa_portfolio_em_palavras<64>(x, semente, unidade, P, est);
+    else
+    {
+        std::cerr << "Erro. O número de possibilidades deve ser no máximo " << X_MAX << "." << std::endl;
+    }
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou acima do suportado:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Portfólio de buscas:
+    Portfolio P;
+    P.parar = false;
+    P.vencedora = -1;
+
+    // Quantidade de soluções distintas desejadas:
+    std::cout << "Entre com um número de soluções desejado: ";
+    std::cin >> P.n_des;
+
+    // Número de buscas (linhas de execução):
+    unsigned int n_t;
+    std::cout << "Entre com um número de buscas simultâneas (0 para o número de núcleos): ";
+    std::cin >> n_t;
+    if(!n_t)
+    {
+        n_t = std::thread::hardware_concurrency();
+        n_t = n_t ? n_t : 1;
+    }
+
+    // Semente da primeira busca:
+    uint64_t semente;
+    std::cout << "Entre com uma semente (0 para aleatória): ";
+    std::cin >> semente;
+    if(!semente)
+    {
+        semente = semente_aleatoria();
+        std::cout << "Semente usada: " << semente << std::endl;
+    }
+
+    // Unidade dos reinícios:
+    unsigned long long unidade;
+    std::cout << "Entre com um número de nós por unidade de reinício de Luby (0 para não reiniciar): ";
+    std::cin >> unidade;
+
+    std::vector<Estatisticas> est(n_t, Estatisticas{0, 0});
+    auto inicio = std::chrono::steady_clock::now();
+    executa_portfolio(x, semente, unidade, P, est);
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+
+    // Número de falsas soluções:
+    unsigned long long n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(auto& S : P.vistas)
+    {
+        // Se não for de fato solução:
+        if(!eh_solucao_de_bits(x, S.data()))
+        {
+            n_f_sol++;
+        }
+    }
+    // Totais das buscas:
+    unsigned long long reinicios = 0, nos = 0;
+    for(auto& e : est)
+    {
+        reinicios += e.reinicios;
+        nos += e.nos;
+    }
+
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << P.vistas.size()-n_f_sol << std::endl;
+    if(P.vencedora >= 0)
+    {
+        std::cout << "Busca que completou as soluções: " << P.vencedora+1 << " (semente " << semente+P.vencedora << ")." << std::endl;
+    }
+    std::cout << "Buscas iniciadas: " << reinicios << "; nós visitados: " << nos << "." << std::endl;
+    std::cout << "Tempo: " << t << " s." << std::endl;
+    return 0;
+}
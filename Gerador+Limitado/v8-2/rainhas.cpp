@@ -6,7 +6,9 @@
 #include <set>
 #include <vector>
 #include <stack>
-#include <ctime>
+#include <cstdint>
+
+#include "../../Biblioteca/aleatorio.hpp"
 
 // Funções para debug:
 void imprime_vetor_de_naturais(unsigned int x, unsigned int* S);
@@ -145,8 +147,9 @@ typedef struct Estado
 // x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
 // n_sol    : número de soluções encontradas;
 // R        : soluções encontradas;
-// n_des    : número de soluções desejadas.
-void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int n_des)
+// n_des    : número de soluções desejadas;
+// semente  : semente do gerador aleatório (a mesma semente gera as mesmas soluções).
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int n_des, uint64_t semente)
 {
     // Se não deseja solução:
     if(!n_des)
@@ -155,8 +158,12 @@ void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsig
         return;
     }
 
-    // Inicializa um gerador de números aleatórios:
-    std::srand(std::time(0));
+    // Gerador de números aleatórios da busca:
+    Xoshiro256 gerador(semente);
+
+    // Vetor contíguo de possibilidades a embaralhar em cada expansão:
+    std::vector<unsigned int> candidatos;
+    candidatos.reserve(x);
 
     // Conjunto de possibilidades de coordenadas de posicionamento das rainhas:
     std::set<unsigned int> omega;
@@ -187,20 +194,14 @@ void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsig
     // Cria espaço de possibilidades:
     std::vector<std::set<unsigned int>> E(x, omega);
 
+    // Embaralha as possibilidades da primeira posição:
+    candidatos.assign(omega.begin(), omega.end());
+    embaralha(candidatos.data(), x, gerador);
     // Para todos as possibilidades:
     for(unsigned int t = 0; t <= x-1; t++)
     {
-        // Sorteia um índice aleatório que leva a um
-        // elemento do conjunto de possibilidades:
-        unsigned int ind = std::rand()%omega.size();
-        // Inicia iterador:
-        auto it = omega.begin();
-        // Avança o iterador para o elemento desejado:
-        std::advance(it, ind);
         // Empilha estado inicial:
-        pilha.push({0, *it});
-        // Deleta a possibilidade:
-        omega.erase(it);
+        pilha.push({0, candidatos[t]});
     }
 
     // Enquanto houver estados:
@@ -299,22 +300,15 @@ void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsig
                 }
             } else
             { // Senão:
-                // Copia o conjunto de possibilidades da posição seguinte:
-                auto temp = E[q.i+1];
+                // Copia as possibilidades da posição seguinte para o vetor
+                // contíguo (sem alocação) e as embaralha em O(tamanho):
+                candidatos.assign(E[q.i+1].begin(), E[q.i+1].end());
+                embaralha(candidatos.data(), candidatos.size(), gerador);
                 // Para todas as possibilidades da posição seguinte:
-                for(unsigned int t = 0; t < temp.size(); t++)
+                for(unsigned int t = 0; t < candidatos.size(); t++)
                 {
-                    // Sorteia um índice aleatório que leva a um
-                    // elemento do conjunto de possibilidades:
-                    unsigned int ind = std::rand()%temp.size();
-                    // Inicia iterador:
-                    auto it = temp.begin();
-                    // Avança o iterador para o elemento desejado:
-                    std::advance(it, ind);
                     // Empilha o uso da possibilidade:
-                    pilha.push({q.i+1, *it});
-                    // Deleta a possibilidade:
-                    temp.erase(it);
+                    pilha.push({q.i+1, candidatos[t]});
                 }
             }
         }
@@ -365,12 +359,22 @@ int main()
     std::cout << "Entre com um número de soluções desejado: ";
     std::cin >> n_des;
 
+    // Semente do gerador aleatório:
+    uint64_t semente;
+    std::cout << "Entre com uma semente (0 para aleatória): ";
+    std::cin >> semente;
+    if(!semente)
+    {
+        semente = semente_aleatoria();
+        std::cout << "Semente usada: " << semente << std::endl;
+    }
+
     // Conjunto de soluções:
     unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
     // Número de soluções:
     unsigned int n_sol = 0;
     // Gera as soluções:
-    gera_solucoes(x, &n_sol, &R, n_des);
+    gera_solucoes(x, &n_sol, &R, n_des, semente);
     // Número de falsas soluções:
     unsigned int n_f_sol = 0;
     // Para todas as supostas soluções:
@@ -0,0 +1,468 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -march=native
+// Observação: -march=native habilita AVX2 (se disponível) na
+// busca pela primeira possibilidade livre de um conjunto de bits.
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Funções para debug:
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S);
+
+// Número de bits de uma palavra:
+#define BITS_POR_PALAVRA 64
+// Maior número de palavras de um conjunto de bits:
+#define PALAVRAS_MAX 64
+// Maior número de possibilidades suportado:
+#define X_MAX (BITS_POR_PALAVRA*PALAVRAS_MAX)
+
+// Conjunto de W palavras, em que o bit b representa a possibilidade b:
+template<unsigned int W>
+struct ConjuntoDeBits
+{
+    uint64_t p[W];
+
+    // Esvazia o conjunto:
+    void zera()
+    {
+        for(unsigned int w = 0; w < W; w++)
+        {
+            p[w] = 0;
+        }
+    }
+
+    // x: número de possibilidades (bits menos significativos) a ligar.
+    void preenche(unsigned int x)
+    {
+        for(unsigned int w = 0; w < W; w++)
+        {
+            // Se a palavra está inteira abaixo de x:
+            if((w+1)*BITS_POR_PALAVRA <= x)
+            {
+                p[w] = ~uint64_t(0);
+            } else if(w*BITS_POR_PALAVRA < x)
+            { // Senão, se a palavra contém o limite:
+                p[w] = (uint64_t(1) << (x - w*BITS_POR_PALAVRA)) - 1;
+            } else
+            { // Senão, a palavra está inteira acima de x:
+                p[w] = 0;
+            }
+        }
+    }
+
+    // b: possibilidade a inserir.
+    void liga(unsigned int b)
+    {
+        p[b/BITS_POR_PALAVRA] |= uint64_t(1) << (b%BITS_POR_PALAVRA);
+    }
+
+    // b: possibilidade a remover.
+    void desliga(unsigned int b)
+    {
+        p[b/BITS_POR_PALAVRA] &= ~(uint64_t(1) << (b%BITS_POR_PALAVRA));
+    }
+
+    // w: índice de palavra do resultado;
+    // q: deslocamento em palavras;
+    // s: deslocamento em bits dentro da palavra.
+    // Retorna a w-ésima palavra do conjunto deslocado q*64+s bits para
+    // possibilidades maiores (os bits atravessam a fronteira das palavras).
+    uint64_t palavra_a_esquerda(unsigned int w, unsigned int q, unsigned int s) const
+    {
+        // Se a palavra de origem está antes do início:
+        if(w < q)
+        {
+            return 0;
+        }
+        uint64_t v = p[w-q] << s;
+        // Se há bits vindos da palavra anterior:
+        if(s && w > q)
+        {
+            v |= p[w-q-1] >> (BITS_POR_PALAVRA-s);
+        }
+        return v;
+    }
+
+    // w: índice de palavra do resultado;
+    // q: deslocamento em palavras;
+    // s: deslocamento em bits dentro da palavra.
+    // Retorna a w-ésima palavra do conjunto deslocado q*64+s bits para
+    // possibilidades menores (os bits atravessam a fronteira das palavras).
+    uint64_t palavra_a_direita(unsigned int w, unsigned int q, unsigned int s) const
+    {
+        // Se a palavra de origem está após o fim:
+        if(w+q >= W)
+        {
+            return 0;
+        }
+        uint64_t v = p[w+q] >> s;
+        // Se há bits vindos da palavra seguinte:
+        if(s && w+q+1 < W)
+        {
+            v |= p[w+q+1] << (BITS_POR_PALAVRA-s);
+        }
+        return v;
+    }
+
+    // n: deslocamento em bits para possibilidades maiores.
+    ConjuntoDeBits desloca_a_esquerda(unsigned int n) const
+    {
+        ConjuntoDeBits r;
+        for(unsigned int w = 0; w < W; w++)
+        {
+            r.p[w] = palavra_a_esquerda(w, n/BITS_POR_PALAVRA, n%BITS_POR_PALAVRA);
+        }
+        return r;
+    }
+
+    // n: deslocamento em bits para possibilidades menores.
+    ConjuntoDeBits desloca_a_direita(unsigned int n) const
+    {
+        ConjuntoDeBits r;
+        for(unsigned int w = 0; w < W; w++)
+        {
+            r.p[w] = palavra_a_direita(w, n/BITS_POR_PALAVRA, n%BITS_POR_PALAVRA);
+        }
+        return r;
+    }
+
+    // Retorna a menor possibilidade do conjunto ou -1 se vazio:
+    int primeiro() const
+    {
+        // Índice de palavra:
+        unsigned int w = 0;
+#if defined(__AVX2__)
+        // Salta blocos de 4 palavras nulas com um único teste vetorial:
+        for(; w+4 <= W; w += 4)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(p+w));
+            // Se o bloco tem algum bit ligado:
+            if(!_mm256_testz_si256(v, v))
+            {
+                break;
+            }
+        }
+#endif
+        // Procura a primeira palavra não nula (do bloco encontrado em diante):
+        for(; w < W; w++)
+        {
+            if(p[w])
+            {
+                // Retorna o índice do bit (contagem de zeros à direita):
+                return int(w*BITS_POR_PALAVRA + __builtin_ctzll(p[w]));
+            }
+        }
+        return -1;
+    }
+
+    // Retorna se o conjunto é vazio:
+    bool vazio() const
+    {
+        return primeiro() < 0;
+    }
+};
+
+// Estrutura de estado de uma profundidade da busca:
+template<unsigned int W>
+struct EstadoDeBits
+{
+    ConjuntoDeBits<W> colunas;       // possibilidades usadas por rainhas anteriores.
+    ConjuntoDeBits<W> diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    ConjuntoDeBits<W> antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    ConjuntoDeBits<W> livres;        // possibilidades ainda não testadas na posição.
+};
+
+// omega    : possibilidades de coordenadas;
+// e        : estado de uma posição;
+// m        : distância da posição do estado até a posição verificada.
+// Retorna se a posição a m posições do estado ainda tem possibilidade
+// (equivale a não zerar o espaço de possibilidades da versão 8):
+template<unsigned int W>
+bool tem_possibilidade(const ConjuntoDeBits<W>& omega, const EstadoDeBits<W>& e, unsigned int m)
+{
+    // Deslocamentos em palavras e em bits:
+    unsigned int q = m/BITS_POR_PALAVRA;
+    unsigned int s = m%BITS_POR_PALAVRA;
+    // Para todas as palavras:
+    for(unsigned int w = 0; w < W; w++)
+    {
+        // Possibilidades atacadas na posição verificada:
+        uint64_t atacadas = e.colunas.p[w] | e.diagonais.palavra_a_esquerda(w, q, s)
+                                | e.antidiagonais.palavra_a_direita(w, q, s);
+        // Se sobra possibilidade:
+        if(omega.p[w] & ~atacadas)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// x        : número de possibilidades de valores para as
+//            coordenadas de uma casa de um (2, x)-tabuleiro;
+// n_sol    : número de soluções encontradas;
+// R        : conjunto de soluções;
+// S        : solução completa.
+void salva_solucao(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int* S)
+{
+    // Incrementa o número de soluções:
+    (*n_sol)++;
+    // Salva a solução:
+    (*R) = (unsigned int**)realloc((*R), sizeof(unsigned int*)*(*n_sol));
+    if(*R == NULL)
+    {
+        std::cerr << "Erro de alocação de memória." << std::endl;
+        exit(1);
+    }
+    (*R)[(*n_sol)-1] = (unsigned int*)malloc(sizeof(unsigned int)*x);
+    for(unsigned int i = 0; i <= x-1; i++)
+    {
+        (*R)[(*n_sol)-1][i] = S[i];
+    }
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas;
+// n_des    : número de soluções desejadas.
+template<unsigned int W>
+void gera_solucoes_em_palavras(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int n_des)
+{
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    ConjuntoDeBits<W> omega;
+    omega.preenche(x);
+
+    // Estados de cada posição:
+    std::vector<EstadoDeBits<W>> P(x);
+
+    // Solução parcial:
+    std::vector<unsigned int> S(x);
+
+    // Inicia a primeira posição com todas as possibilidades:
+    P[0].colunas.zera();
+    P[0].diagonais.zera();
+    P[0].antidiagonais.zera();
+    P[0].livres = omega;
+
+    // Índice de profundidade:
+    unsigned int i = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Menor possibilidade livre da posição atual:
+        int b = P[i].livres.primeiro();
+
+        // Se esgotou as possibilidades da posição atual:
+        if(b < 0)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                return;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Marca a possibilidade como testada:
+        P[i].livres.desliga(b);
+        // Salva a coordenada na solução parcial:
+        S[i] = b;
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(i == x-1)
+        {
+            // Completou uma solução:
+            salva_solucao(x, n_sol, R, S.data());
+
+            // Se encontrou o número de soluções desejado:
+            if(*n_sol == n_des)
+            {
+                // Retorna.
+                return;
+            }
+            continue;
+        }
+
+        // Estado da posição seguinte:
+        EstadoDeBits<W>& e = P[i+1];
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        e.colunas = P[i].colunas;
+        e.colunas.liga(b);
+        e.diagonais = P[i].diagonais;
+        e.diagonais.liga(b);
+        e.diagonais = e.diagonais.desloca_a_esquerda(1);
+        e.antidiagonais = P[i].antidiagonais;
+        e.antidiagonais.liga(b);
+        e.antidiagonais = e.antidiagonais.desloca_a_direita(1);
+        // Possibilidades não atacadas na posição seguinte:
+        for(unsigned int w = 0; w < W; w++)
+        {
+            e.livres.p[w] = omega.p[w] & ~(e.colunas.p[w] | e.diagonais.p[w] | e.antidiagonais.p[w]);
+        }
+
+        // Se zerou as possibilidades da posição seguinte:
+        if(e.livres.vazio())
+        {
+            // Tenta a próxima possibilidade da posição atual:
+            continue;
+        }
+
+        // Bandeira para sinalizar se alguma posição
+        // posterior teve as possibilidades zeradas:
+        bool zerou = false;
+
+        // Para todas as profundidades além da seguinte:
+        for(unsigned int m = 1; m <= (x-1)-(i+1); m++)
+        {
+            // Se a posição não tem mais possibilidades:
+            if(!tem_possibilidade(omega, e, m))
+            {
+                // Atualiza a bandeira:
+                zerou = true;
+
+                // Sai do loop:
+                break;
+            }
+        }
+
+        // Se não zerou as possibilidades de alguma posição:
+        if(!zerou)
+        {
+            // Avança para a posição seguinte:
+            i++;
+        }
+    }
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas;
+// n_des    : número de soluções desejadas.
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int n_des)
+{
+    // Se não deseja solução:
+    if(!n_des)
+    {
+        // Retorna:
+        return;
+    }
+
+    // Número de palavras necessárias:
+    unsigned int n_palavras = (x+BITS_POR_PALAVRA-1)/BITS_POR_PALAVRA;
+
+    // Escolhe a menor instância que comporta as possibilidades:
+    if(n_palavras <= 1)       gera_solucoes_em_palavras<1>(x, n_sol, R, n_des);
+    else if(n_palavras <= 2)  gera_solucoes_em_palavras<2>(x, n_sol, R, n_des);
+    else if(n_palavras <= 4)  gera_solucoes_em_palavras<4>(x, n_sol, R, n_des);
+    else if(n_palavras <= 8)  gera_solucoes_em_palavras<8>(x, n_sol, R, n_des);
+    else if(n_palavras <= 16) gera_solucoes_em_palavras<16>(x, n_sol, R, n_des);
+    else if(n_palavras <= 32) gera_solucoes_em_palavras<32>(x, n_sol, R, n_des);
+    else if(n_palavras <= 64) gera_solucoes_em_palavras<64>(x, n_sol, R, n_des);
+    else
+    {
+        std::cerr << "Erro. O número de possibilidades deve ser no máximo " << X_MAX << "." << std::endl;
+    }
+}
+
+#include <cmath> // abs
+
+// x: número de possibilidades de valores para as
+//    coordenadas de uma casa de um (2, x)-tabuleiro;
+// S: suposta solução.
+bool eh_solucao(unsigned int x, unsigned int* S)
+{
+    // Para todas as componentes de linha das rainhas (exceto da última):
+    for(unsigned int j = 0; j < x-1; j++)
+    {
+        // Para todas as componentes de linha das rainhas (do loop anterior em diante):
+        for(unsigned int i = j+1; i < x; i++)
+        {
+            // Se estão em mesma linha ou coluna ou diagonal:
+            if(S[j] == S[i] || std::abs(int(j - i)) == std::abs(int(S[j] - S[i])))
+            {
+                // Não é solução.
+                return false;
+            }
+        }
+    }
+    // É solução.
+    return true;
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou acima do suportado:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Quantidade de soluções desejadas:
+    unsigned int n_des;
+    std::cout << "Entre com um número de soluções desejado: ";
+    std::cin >> n_des;
+
+    // Conjunto de soluções:
+    unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
+    // Número de soluções:
+    unsigned int n_sol = 0;
+    // Gera as soluções:
+    gera_solucoes(x, &n_sol, &R, n_des);
+    // Número de falsas soluções:
+    unsigned int n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Se não for de fato solução:
+        if(!eh_solucao(x, R[i]))
+        {
+            n_f_sol++;
+        }
+    }
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+
+    // Libera a memória alocada:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Libera a (i+1)-ésima solução:
+        free(R[i]);
+    }
+    free(R);
+    return 0;
+}
+
+// x: número de elementos;
+// S: vetor de naturais a ser imprimido.
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S)
+{
+    // Abre vetor:
+    std::cout << "[";
+
+    // Para todos os elementos exceto o último:
+    for(unsigned int i = 0; i < x-1; i++)
+    {
+        // Imprime elemento e separador:
+        std::cout << S[i] << ", ";
+    }
+    // Imprime o último elemento:
+    if(x) std::cout << S[x-1];
+
+    // Fecha vetor:
+    std::cout << "]" << std::endl;
+}
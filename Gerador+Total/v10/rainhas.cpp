@@ -0,0 +1,352 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include <chrono>
+
+// Funções para debug:
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S);
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX 64
+// Maior número de possibilidades com instância especializada em tempo de compilação:
+#define X_ESPECIALIZADO_MAX 20
+
+// x        : número de possibilidades de valores para as
+//            coordenadas de uma casa de um (2, x)-tabuleiro;
+// n_sol    : número de soluções encontradas;
+// R        : conjunto de soluções (se nulo, apenas conta as soluções);
+// S        : solução completa.
+void salva_solucao(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int* S)
+{
+    // Incrementa o número de soluções:
+    (*n_sol)++;
+    // Se apenas conta as soluções:
+    if(R == NULL)
+    {
+        return;
+    }
+    // Salva a solução:
+    (*R) = (unsigned int**)realloc((*R), sizeof(unsigned int*)*(*n_sol));
+    if(*R == NULL)
+    {
+        std::cerr << "Erro de alocação de memória." << std::endl;
+        exit(1);
+    }
+    (*R)[(*n_sol)-1] = (unsigned int*)malloc(sizeof(unsigned int)*x);
+    for(unsigned int i = 0; i <= x-1; i++)
+    {
+        (*R)[(*n_sol)-1][i] = S[i];
+    }
+}
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+constexpr uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades, retorna a palavra
+    // cheia, senão, retorna os x bits menos significativos:
+    return x == X_MAX ? ~uint64_t(0) : (uint64_t(1) << x) - 1;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas (se nulo, apenas conta as soluções).
+// Caminho genérico (o da versão 9), com x conhecido apenas em tempo de execução:
+void gera_solucoes_generico(unsigned int x, unsigned int* n_sol, unsigned int*** R)
+{
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+
+    // Estados de cada posição:
+    std::vector<estado_de_bits> P(x);
+
+    // Solução parcial:
+    std::vector<unsigned int> S(x);
+
+    // Inicia a primeira posição com todas as possibilidades:
+    P[0] = {0, 0, 0, omega};
+
+    // Índice de profundidade:
+    unsigned int i = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+        // Salva a coordenada na solução parcial:
+        S[i] = __builtin_ctzll(bit);
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(i == x-1)
+        {
+            // Completou uma solução:
+            salva_solucao(x, n_sol, R, S.data());
+            continue;
+        }
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+    }
+}
+
+// Resolvedor especializado para X possibilidades. Como X e a profundidade
+// são parâmetros de modelo, cada profundidade é uma função própria e o
+// compilador pode desenrolar e propagar as constantes das profundidades;
+// a solução parcial fica em um arranjo de tamanho fixo na pilha:
+template<unsigned int X>
+class Resolvedor
+{
+    public:
+        // n_sol    : número de soluções encontradas;
+        // R        : soluções encontradas (se nulo, apenas conta as soluções).
+        void gera_solucoes(unsigned int* n_sol, unsigned int*** R)
+        {
+            gera<0>(0, 0, 0, n_sol, R);
+        }
+
+    private:
+        // Possibilidades de coordenadas de posicionamento das rainhas:
+        static constexpr uint64_t omega = mascara_de_possibilidades(X);
+
+        // Solução parcial:
+        unsigned int S[X];
+
+        // I        : índice de profundidade;
+        // c        : possibilidades usadas por rainhas anteriores;
+        // d        : possibilidades atacadas por diagonais;
+        // a        : possibilidades atacadas por antidiagonais;
+        // n_sol    : número de soluções encontradas;
+        // R        : soluções encontradas.
+        template<unsigned int I>
+        void gera(uint64_t c, uint64_t d, uint64_t a, unsigned int* n_sol, unsigned int*** R)
+        {
+            // Possibilidades não atacadas na posição:
+            uint64_t livres = omega & ~(c | d | a);
+            // Enquanto houver possibilidades:
+            while(livres)
+            {
+                // Isola a menor possibilidade livre:
+                uint64_t bit = livres & (~livres + 1);
+                // Marca a possibilidade como testada:
+                livres ^= bit;
+                // Salva a coordenada na solução parcial:
+                S[I] = __builtin_ctzll(bit);
+
+                // Se é a posição de fim de solução:
+                if constexpr(I == X-1)
+                {
+                    // Completou uma solução:
+                    salva_solucao(X, n_sol, R, S);
+                } else
+                { // Senão, avança para a posição seguinte:
+                    gera<I+1>(c | bit, (d | bit) << 1, (a | bit) >> 1, n_sol, R);
+                }
+            }
+        }
+};
+
+// X        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas (se nulo, apenas conta as soluções).
+template<unsigned int X>
+void gera_solucoes_especializado(unsigned int* n_sol, unsigned int*** R)
+{
+    // Instância na pilha:
+    Resolvedor<X> r;
+    r.gera_solucoes(n_sol, R);
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas (se nulo, apenas conta as soluções).
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R)
+{
+    // Escolhe a instância especializada para x (ou o caminho genérico):
+    switch(x)
+    {
+        case 1:  gera_solucoes_especializado<1>(n_sol, R);  break;
+        case 2:  gera_solucoes_especializado<2>(n_sol, R);  break;
+        case 3:  gera_solucoes_especializado<3>(n_sol, R);  break;
+        case 4:  gera_solucoes_especializado<4>(n_sol, R);  break;
+        case 5:  gera_solucoes_especializado<5>(n_sol, R);  break;
+        case 6:  gera_solucoes_especializado<6>(n_sol, R);  break;
+        case 7:  gera_solucoes_especializado<7>(n_sol, R);  break;
+        case 8:  gera_solucoes_especializado<8>(n_sol, R);  break;
+        case 9:  gera_solucoes_especializado<9>(n_sol, R);  break;
+        case 10: gera_solucoes_especializado<10>(n_sol, R); break;
+        case 11: gera_solucoes_especializado<11>(n_sol, R); break;
+        case 12: gera_solucoes_especializado<12>(n_sol, R); break;
+        case 13: gera_solucoes_especializado<13>(n_sol, R); break;
+        case 14: gera_solucoes_especializado<14>(n_sol, R); break;
+        case 15: gera_solucoes_especializado<15>(n_sol, R); break;
+        case 16: gera_solucoes_especializado<16>(n_sol, R); break;
+        case 17: gera_solucoes_especializado<17>(n_sol, R); break;
+        case 18: gera_solucoes_especializado<18>(n_sol, R); break;
+        case 19: gera_solucoes_especializado<19>(n_sol, R); break;
+        case 20: gera_solucoes_especializado<20>(n_sol, R); break;
+        default: gera_solucoes_generico(x, n_sol, R);       break;
+    }
+}
+
+#include <cmath> // abs
+
+// x: número de possibilidades de valores para as
+//    coordenadas de uma casa de um (2, x)-tabuleiro;
+// S: suposta solução.
+bool eh_solucao(unsigned int x, unsigned int* S)
+{
+    // Para todas as componentes de linha das rainhas (exceto da última):
+    for(unsigned int j = 0; j < x-1; j++)
+    {
+        // Para todas as componentes de linha das rainhas (do loop anterior em diante):
+        for(unsigned int i = j+1; i < x; i++)
+        {
+            // Se estão em mesma linha ou coluna ou diagonal:
+            if(S[j] == S[i] || std::abs(int(j - i)) == std::abs(int(S[j] - S[i])))
+            {
+                // Não é solução.
+                return false;
+            }
+        }
+    }
+    // É solução.
+    return true;
+}
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+// Compara, só contando as soluções (sem o custo de salvá-las),
+// o caminho genérico com a instância especializada para x:
+void compara_caminhos(unsigned int x)
+{
+    // Números de soluções de cada caminho:
+    unsigned int n_sol_generico = 0;
+    unsigned int n_sol_especializado = 0;
+
+    // Mede o caminho genérico:
+    auto t0 = std::chrono::steady_clock::now();
+    gera_solucoes_generico(x, &n_sol_generico, NULL);
+    auto t1 = std::chrono::steady_clock::now();
+    // Mede o caminho escolhido pelo despachante:
+    gera_solucoes(x, &n_sol_especializado, NULL);
+    auto t2 = std::chrono::steady_clock::now();
+
+    // Tempos em segundos:
+    double s_generico = std::chrono::duration<double>(t1-t0).count();
+    double s_especializado = std::chrono::duration<double>(t2-t1).count();
+
+    std::cout << "Caminho genérico: " << n_sol_generico << " soluções em " << s_generico << " s." << std::endl;
+    std::cout << "Caminho especializado" << (x <= X_ESPECIALIZADO_MAX ? "" : " (indisponível, usa o genérico)")
+                << ": " << n_sol_especializado << " soluções em " << s_especializado << " s." << std::endl;
+    // Se o tempo especializado é mensurável:
+    if(s_especializado > 0)
+    {
+        std::cout << "Aceleração: " << s_generico/s_especializado << "x" << std::endl;
+    }
+    // Se os caminhos divergem:
+    if(n_sol_generico != n_sol_especializado)
+    {
+        std::cout << "Erro: os caminhos encontraram números de soluções diferentes." << std::endl;
+    }
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Conjunto de soluções:
+    unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
+    // Número de soluções:
+    unsigned int n_sol = 0;
+    // Gera as soluções:
+    gera_solucoes(x, &n_sol, &R);
+    // Número de falsas soluções:
+    unsigned int n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Se não for de fato solução:
+        if(!eh_solucao(x, R[i]))
+        {
+            n_f_sol++;
+        }
+    }
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+
+    // Libera a memória alocada:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Libera a (i+1)-ésima solução:
+        free(R[i]);
+    }
+    free(R);
+
+    // Compara os caminhos genérico e especializado:
+    compara_caminhos(x);
+    return 0;
+}
+
+// x: número de elementos;
+// S: vetor de naturais a ser imprimido.
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S)
+{
+    // Abre vetor:
+    std::cout << "[";
+
+    // Para todos os elementos exceto o último:
+    for(unsigned int i = 0; i < x-1; i++)
+    {
+        // Imprime elemento e separador:
+        std::cout << S[i] << ", ";
+    }
+    // Imprime o último elemento:
+    if(x) std::cout << S[x-1];
+
+    // Fecha vetor:
+    std::cout << "]" << std::endl;
+}
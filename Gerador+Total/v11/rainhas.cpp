@@ -0,0 +1,401 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -pthread
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Funções para debug:
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S);
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX 64
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// Subárvore independente da busca, dada por um prefixo de solução:
+typedef struct Tarefa
+{
+    unsigned int k;                 // profundidade do prefixo (número de rainhas posicionadas).
+    uint64_t colunas;               // possibilidades usadas pelo prefixo.
+    uint64_t diagonais;             // diagonais do prefixo projetadas na posição k.
+    uint64_t antidiagonais;         // antidiagonais do prefixo projetadas na posição k.
+    std::vector<unsigned int> S;    // prefixo (e espaço para o restante da solução).
+    std::vector<unsigned int> sols; // soluções da subárvore, concatenadas (x coordenadas cada).
+} tarefa;
+
+// Fila de tarefas de um trabalhador. O dono retira do fim e os
+// ladrões retiram do início; o trinco é tomado uma vez por tarefa,
+// nunca durante a busca dentro de uma tarefa:
+typedef struct Fila
+{
+    std::mutex trinco;
+    std::deque<tarefa*> tarefas;
+} fila;
+
+// Contadores de um trabalhador, reduzidos apenas ao final. Os contadores
+// de trabalhadores vizinhos dividem linhas de cache no vetor, então cada
+// trabalhador conta em uma cópia local e só escreve no vetor ao terminar:
+typedef struct Contadores
+{
+    unsigned long long n_sol;       // soluções encontradas.
+    unsigned long long n_tarefas;   // tarefas executadas.
+    unsigned long long n_roubadas;  // tarefas roubadas de outros trabalhadores.
+} contadores;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades:
+    if(x == X_MAX)
+    {
+        // Retorna a palavra cheia:
+        return ~uint64_t(0);
+    }
+    // Retorna os x bits menos significativos:
+    return (uint64_t(1) << x) - 1;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// k        : profundidade de divisão;
+// i        : índice de profundidade atual;
+// c, d, a  : colunas, diagonais e antidiagonais atacadas na posição i;
+// S        : prefixo atual;
+// T        : tarefas geradas (em ordem de busca).
+void divide_em_tarefas(unsigned int x, unsigned int k, unsigned int i, uint64_t c, uint64_t d, uint64_t a,
+                        std::vector<unsigned int>& S, std::vector<tarefa*>& T)
+{
+    // Se o prefixo atingiu a profundidade de divisão:
+    if(i == k)
+    {
+        // Cria a tarefa da subárvore:
+        T.push_back(new tarefa{k, c, d, a, S, {}});
+        return;
+    }
+    // Possibilidades não atacadas na posição:
+    uint64_t livres = mascara_de_possibilidades(x) & ~(c | d | a);
+    // Para todas as possibilidades livres:
+    while(livres)
+    {
+        // Isola a menor possibilidade livre:
+        uint64_t bit = livres & (~livres + 1);
+        livres ^= bit;
+        // Estende o prefixo:
+        S[i] = __builtin_ctzll(bit);
+        divide_em_tarefas(x, k, i+1, c | bit, (d | bit) << 1, (a | bit) >> 1, S, T);
+    }
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// t        : tarefa a executar;
+// P        : estados de cada posição (próprios do trabalhador);
+// cont     : contadores do trabalhador.
+void executa_tarefa(unsigned int x, tarefa* t, std::vector<estado_de_bits>& P, contadores& cont)
+{
+    // Se o prefixo já é uma solução completa:
+    if(t->k == x)
+    {
+        t->sols.insert(t->sols.end(), t->S.begin(), t->S.end());
+        cont.n_sol++;
+        return;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+
+    // Inicia a posição k com as possibilidades não atacadas pelo prefixo:
+    P[t->k] = {t->colunas, t->diagonais, t->antidiagonais,
+                omega & ~(t->colunas | t->diagonais | t->antidiagonais)};
+
+    // Índice de profundidade:
+    unsigned int i = t->k;
+
+    // Enquanto houver estados na subárvore:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a raiz da subárvore, terminou a tarefa:
+            if(i == t->k)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+        // Salva a coordenada na solução parcial:
+        t->S[i] = __builtin_ctzll(bit);
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(i == x-1)
+        {
+            // Completou uma solução (salva na própria tarefa, sem trinco):
+            t->sols.insert(t->sols.end(), t->S.begin(), t->S.end());
+            cont.n_sol++;
+            continue;
+        }
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+    }
+}
+
+// id       : índice do trabalhador;
+// F        : filas de todos os trabalhadores.
+// Retorna a próxima tarefa do trabalhador (própria ou roubada), ou nulo se não há mais:
+tarefa* proxima_tarefa(unsigned int id, std::vector<fila>& F, contadores& cont)
+{
+    // Tenta retirar do fim da própria fila:
+    {
+        std::lock_guard<std::mutex> g(F[id].trinco);
+        if(!F[id].tarefas.empty())
+        {
+            tarefa* t = F[id].tarefas.back();
+            F[id].tarefas.pop_back();
+            return t;
+        }
+    }
+    // Para todos os outros trabalhadores (a partir do seguinte):
+    for(unsigned int v = 1; v < F.size(); v++)
+    {
+        // Vítima do roubo:
+        fila& vitima = F[(id+v)%F.size()];
+        std::lock_guard<std::mutex> g(vitima.trinco);
+        // Se a vítima tem tarefas:
+        if(!vitima.tarefas.empty())
+        {
+            // Rouba do início da fila (as subárvores mais distantes do dono):
+            tarefa* t = vitima.tarefas.front();
+            vitima.tarefas.pop_front();
+            cont.n_roubadas++;
+            return t;
+        }
+    }
+    // Como nenhuma tarefa é criada durante a execução, acabaram as tarefas:
+    return NULL;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// id       : índice do trabalhador;
+// F        : filas de todos os trabalhadores;
+// cont     : contadores do trabalhador.
+void trabalhador(unsigned int x, unsigned int id, std::vector<fila>* F, contadores* cont)
+{
+    // Estados de cada posição, próprios do trabalhador:
+    std::vector<estado_de_bits> P(x);
+    // Contadores locais (sem compartilhar linha de cache com outros trabalhadores):
+    contadores local = {0, 0, 0};
+
+    // Enquanto houver tarefas:
+    while(tarefa* t = proxima_tarefa(id, *F, local))
+    {
+        executa_tarefa(x, t, P, local);
+        local.n_tarefas++;
+    }
+
+    // Escreve os contadores uma única vez:
+    *cont = local;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas;
+// k        : profundidade de divisão da árvore de busca em tarefas;
+// n_t      : número de trabalhadores.
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int k, unsigned int n_t)
+{
+    // Se não cabe em uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cerr << "Erro. O número de possibilidades deve estar entre 1 e " << X_MAX << "." << std::endl;
+        return;
+    }
+    // Limita a profundidade de divisão e garante um trabalhador:
+    if(k > x) k = x;
+    if(!n_t) n_t = 1;
+
+    // Divide a árvore de busca em tarefas pelos prefixos de profundidade k:
+    std::vector<tarefa*> T;
+    std::vector<unsigned int> S(x);
+    divide_em_tarefas(x, k, 0, 0, 0, 0, S, T);
+
+    // Distribui as tarefas em blocos contíguos entre os trabalhadores:
+    std::vector<fila> F(n_t);
+    for(size_t t = 0; t < T.size(); t++)
+    {
+        F[t*n_t/T.size()].tarefas.push_back(T[t]);
+    }
+
+    // Executa os trabalhadores:
+    std::vector<contadores> C(n_t, {0, 0, 0});
+    std::vector<std::thread> trabalhadores;
+    for(unsigned int id = 0; id < n_t; id++)
+    {
+        trabalhadores.emplace_back(trabalhador, x, id, &F, &C[id]);
+    }
+    for(auto& th : trabalhadores)
+    {
+        th.join();
+    }
+
+    // Reduz os contadores dos trabalhadores:
+    unsigned long long total = 0;
+    for(unsigned int id = 0; id < n_t; id++)
+    {
+        std::cout << "Trabalhador " << id << ": " << C[id].n_tarefas << " tarefas ("
+                    << C[id].n_roubadas << " roubadas), " << C[id].n_sol << " soluções." << std::endl;
+        total += C[id].n_sol;
+    }
+
+    // Salva as soluções das tarefas em ordem de busca (uma realocação só):
+    (*R) = (unsigned int**)realloc((*R), sizeof(unsigned int*)*(total ? (*n_sol)+total : 1));
+    if(*R == NULL)
+    {
+        std::cerr << "Erro de alocação de memória." << std::endl;
+        exit(1);
+    }
+    // Para todas as tarefas:
+    for(auto t : T)
+    {
+        // Para todas as soluções da tarefa:
+        for(size_t s = 0; s < t->sols.size(); s += x)
+        {
+            (*R)[*n_sol] = (unsigned int*)malloc(sizeof(unsigned int)*x);
+            for(unsigned int i = 0; i <= x-1; i++)
+            {
+                (*R)[*n_sol][i] = t->sols[s+i];
+            }
+            (*n_sol)++;
+        }
+        // Libera a tarefa:
+        delete t;
+    }
+}
+
+#include <cmath> // abs
+
+// x: número de possibilidades de valores para as
+//    coordenadas de uma casa de um (2, x)-tabuleiro;
+// S: suposta solução.
+bool eh_solucao(unsigned int x, unsigned int* S)
+{
+    // Para todas as componentes de linha das rainhas (exceto da última):
+    for(unsigned int j = 0; j < x-1; j++)
+    {
+        // Para todas as componentes de linha das rainhas (do loop anterior em diante):
+        for(unsigned int i = j+1; i < x; i++)
+        {
+            // Se estão em mesma linha ou coluna ou diagonal:
+            if(S[j] == S[i] || std::abs(int(j - i)) == std::abs(int(S[j] - S[i])))
+            {
+                // Não é solução.
+                return false;
+            }
+        }
+    }
+    // É solução.
+    return true;
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Profundidade de divisão da árvore de busca em tarefas:
+    unsigned int k;
+    std::cout << "Entre com uma profundidade de divisão em tarefas desejada: ";
+    std::cin >> k;
+
+    // Número de trabalhadores:
+    unsigned int n_t;
+    std::cout << "Entre com um número de trabalhadores desejado (0 para um por núcleo): ";
+    std::cin >> n_t;
+    if(!n_t)
+    {
+        n_t = std::thread::hardware_concurrency();
+    }
+
+    // Conjunto de soluções:
+    unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
+    // Número de soluções:
+    unsigned int n_sol = 0;
+    // Gera as soluções:
+    gera_solucoes(x, &n_sol, &R, k, n_t);
+    // Número de falsas soluções:
+    unsigned int n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Se não for de fato solução:
+        if(!eh_solucao(x, R[i]))
+        {
+            n_f_sol++;
+        }
+    }
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+
+    // Libera a memória alocada:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Libera a (i+1)-ésima solução:
+        free(R[i]);
+    }
+    free(R);
+    return 0;
+}
+
+// x: número de elementos;
+// S: vetor de naturais a ser imprimido.
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S)
+{
+    // Abre vetor:
+    std::cout << "[";
+
+    // Para todos os elementos exceto o último:
+    for(unsigned int i = 0; i < x-1; i++)
+    {
+        // Imprime elemento e separador:
+        std::cout << S[i] << ", ";
+    }
+    // Imprime o último elemento:
+    if(x) std::cout << S[x-1];
+
+    // Fecha vetor:
+    std::cout << "]" << std::endl;
+}
@@ -0,0 +1,356 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+// Funções para debug:
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S);
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX 64
+// Número de simetrias do tabuleiro (grupo diedral D4):
+#define N_SIMETRIAS 8
+
+// x        : número de possibilidades de valores para as
+//            coordenadas de uma casa de um (2, x)-tabuleiro;
+// n_sol    : número de soluções encontradas;
+// R        : conjunto de soluções;
+// S        : solução completa.
+void salva_solucao(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int* S)
+{
+    // Incrementa o número de soluções:
+    (*n_sol)++;
+    // Salva a solução:
+    (*R) = (unsigned int**)realloc((*R), sizeof(unsigned int*)*(*n_sol));
+    if(*R == NULL)
+    {
+        std::cerr << "Erro de alocação de memória." << std::endl;
+        exit(1);
+    }
+    (*R)[(*n_sol)-1] = (unsigned int*)malloc(sizeof(unsigned int)*x);
+    for(unsigned int i = 0; i <= x-1; i++)
+    {
+        (*R)[(*n_sol)-1][i] = S[i];
+    }
+}
+
+// x    : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// S    : solução;
+// T    : imagens de S pelas 8 simetrias do tabuleiro (8*x coordenadas).
+void aplica_simetrias(unsigned int x, unsigned int* S, unsigned int* T)
+{
+    // Para todas as posições:
+    for(unsigned int i = 0; i <= x-1; i++)
+    {
+        // Coordenadas espelhadas:
+        unsigned int i_e = (x-1)-i;
+        unsigned int s_e = (x-1)-S[i];
+        // Identidade:
+        T[0*x+i] = S[i];
+        // Reflexão das coordenadas:
+        T[1*x+i] = s_e;
+        // Reflexão das posições:
+        T[2*x+i_e] = S[i];
+        // Rotação de 180°:
+        T[3*x+i_e] = s_e;
+        // Transposição (troca posição e coordenada):
+        T[4*x+S[i]] = i;
+        // Rotação de 90°:
+        T[5*x+S[i]] = i_e;
+        // Rotação de 270°:
+        T[6*x+s_e] = i;
+        // Transposição pela outra diagonal:
+        T[7*x+s_e] = i_e;
+    }
+}
+
+// x: número de elementos;
+// A: vetor de naturais;
+// B: vetor de naturais.
+// Retorna negativo, zero ou positivo se A é lexicograficamente menor, igual ou maior que B:
+int compara(unsigned int x, unsigned int* A, unsigned int* B)
+{
+    for(unsigned int i = 0; i <= x-1; i++)
+    {
+        if(A[i] != B[i])
+        {
+            return A[i] < B[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// x    : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// S    : solução;
+// T    : espaço para as imagens de S pelas simetrias (8*x coordenadas).
+// Retorna 0 se S não é a menor solução (lexicograficamente) de sua órbita,
+// senão, retorna o tamanho da órbita (1, 2, 4 ou 8), deixando em T as
+// imagens distintas nas primeiras posições:
+unsigned int classifica_orbita(unsigned int x, unsigned int* S, unsigned int* T)
+{
+    // Calcula as imagens:
+    aplica_simetrias(x, S, T);
+
+    // Número de imagens distintas:
+    unsigned int n = 0;
+    // Para todas as imagens:
+    for(unsigned int t = 0; t < N_SIMETRIAS; t++)
+    {
+        // Se alguma imagem é menor, S não é a representante da órbita:
+        if(compara(x, T+t*x, S) < 0)
+        {
+            return 0;
+        }
+        // Bandeira para sinalizar se a imagem já apareceu:
+        bool repetida = false;
+        for(unsigned int u = 0; u < n; u++)
+        {
+            if(!compara(x, T+t*x, T+u*x))
+            {
+                repetida = true;
+                break;
+            }
+        }
+        // Se é uma imagem nova, move para o fim das imagens distintas:
+        if(!repetida)
+        {
+            for(unsigned int i = 0; i <= x-1; i++)
+            {
+                T[n*x+i] = T[t*x+i];
+            }
+            n++;
+        }
+    }
+    return n;
+}
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades:
+    if(x == X_MAX)
+    {
+        // Retorna a palavra cheia:
+        return ~uint64_t(0);
+    }
+    // Retorna os x bits menos significativos:
+    return (uint64_t(1) << x) - 1;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções salvas;
+// R        : soluções salvas (fundamentais ou todas, conforme expande);
+// expande  : se verdadeiro, salva todas as imagens de cada solução fundamental;
+// orbitas  : número de soluções fundamentais por tamanho de órbita (índices 1, 2, 4 e 8).
+// Busca apenas a metade esquerda da primeira posição (e, para x ímpar com
+// a primeira rainha no centro, a metade esquerda da segunda posição), ou
+// seja, um representante de cada par de soluções espelhadas, e classifica
+// as órbitas das soluções que são representantes lexicográficos:
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, bool expande, unsigned long long* orbitas)
+{
+    // Se não cabe em uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cerr << "Erro. O número de possibilidades deve estar entre 1 e " << X_MAX << "." << std::endl;
+        return;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+    // Possibilidades da metade esquerda (sem o centro):
+    uint64_t metade = (uint64_t(1) << (x/2)) - 1;
+    // Possibilidade central (apenas para x ímpar):
+    uint64_t centro = (x%2) ? uint64_t(1) << (x/2) : 0;
+
+    // Estados de cada posição:
+    std::vector<estado_de_bits> P(x);
+
+    // Solução parcial:
+    std::vector<unsigned int> S(x);
+
+    // Imagens de uma solução pelas simetrias:
+    std::vector<unsigned int> T(N_SIMETRIAS*x);
+
+    // Inicia a primeira posição apenas com a metade esquerda e o centro:
+    P[0] = {0, 0, 0, metade | centro};
+
+    // Índice de profundidade:
+    unsigned int i = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+        // Salva a coordenada na solução parcial:
+        S[i] = __builtin_ctzll(bit);
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(i == x-1)
+        {
+            // Tamanho da órbita (zero se não é a representante):
+            unsigned int o = classifica_orbita(x, S.data(), T.data());
+            // Se é uma solução fundamental:
+            if(o)
+            {
+                orbitas[o]++;
+                // Salva a solução fundamental ou toda a sua órbita:
+                for(unsigned int t = 0; t < (expande ? o : 1); t++)
+                {
+                    salva_solucao(x, n_sol, R, T.data()+t*x);
+                }
+            }
+            continue;
+        }
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+        // Se a primeira rainha está no centro, o espelho da solução
+        // também tem a rainha no centro, então restringe a segunda:
+        if(i == 1 && bit == centro)
+        {
+            P[i].livres &= metade;
+        }
+    }
+}
+
+#include <cmath> // abs
+
+// x: número de possibilidades de valores para as
+//    coordenadas de uma casa de um (2, x)-tabuleiro;
+// S: suposta solução.
+bool eh_solucao(unsigned int x, unsigned int* S)
+{
+    // Para todas as componentes de linha das rainhas (exceto da última):
+    for(unsigned int j = 0; j < x-1; j++)
+    {
+        // Para todas as componentes de linha das rainhas (do loop anterior em diante):
+        for(unsigned int i = j+1; i < x; i++)
+        {
+            // Se estão em mesma linha ou coluna ou diagonal:
+            if(S[j] == S[i] || std::abs(int(j - i)) == std::abs(int(S[j] - S[i])))
+            {
+                // Não é solução.
+                return false;
+            }
+        }
+    }
+    // É solução.
+    return true;
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Se deseja a lista completa de soluções:
+    unsigned int expande;
+    std::cout << "Entre com 1 para salvar todas as soluções ou 0 para salvar apenas as fundamentais: ";
+    std::cin >> expande;
+
+    // Número de soluções fundamentais por tamanho de órbita:
+    unsigned long long orbitas[N_SIMETRIAS+1] = {0};
+    // Conjunto de soluções:
+    unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
+    // Número de soluções:
+    unsigned int n_sol = 0;
+    // Gera as soluções:
+    gera_solucoes(x, &n_sol, &R, expande, orbitas);
+    // Número de falsas soluções:
+    unsigned int n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Se não for de fato solução:
+        if(!eh_solucao(x, R[i]))
+        {
+            n_f_sol++;
+        }
+    }
+
+    // Número de soluções fundamentais e total pelas órbitas:
+    unsigned long long n_fund = 0;
+    unsigned long long total = 0;
+    for(unsigned int o = 1; o <= N_SIMETRIAS; o *= 2)
+    {
+        std::cout << "Soluções fundamentais com órbita de tamanho " << o << ": " << orbitas[o] << std::endl;
+        n_fund += orbitas[o];
+        total += o*orbitas[o];
+    }
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções fundamentais para o problema (2, " << x << ")-Rainhas Padrão: " << n_fund << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << total << std::endl;
+
+    // Libera a memória alocada:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Libera a (i+1)-ésima solução:
+        free(R[i]);
+    }
+    free(R);
+    return 0;
+}
+
+// x: número de elementos;
+// S: vetor de naturais a ser imprimido.
+void imprime_vetor_de_naturais(unsigned int x, unsigned int* S)
+{
+    // Abre vetor:
+    std::cout << "[";
+
+    // Para todos os elementos exceto o último:
+    for(unsigned int i = 0; i < x-1; i++)
+    {
+        // Imprime elemento e separador:
+        std::cout << S[i] << ", ";
+    }
+    // Imprime o último elemento:
+    if(x) std::cout << S[x-1];
+
+    // Fecha vetor:
+    std::cout << "]" << std::endl;
+}
@@ -0,0 +1,160 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX 64
+
+// Contador de 128 bits (extensão do GCC e do Clang):
+typedef unsigned __int128 contador128;
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades:
+    if(x == X_MAX)
+    {
+        // Retorna a palavra cheia:
+        return ~uint64_t(0);
+    }
+    // Retorna os x bits menos significativos:
+    return (uint64_t(1) << x) - 1;
+}
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+// Retorna o número de soluções sem salvar nenhuma delas (a memória usada
+// é constante em relação ao número de soluções). O tipo do contador é o
+// parâmetro de modelo T (por exemplo, unsigned long long ou contador128):
+template<typename T>
+T conta_solucoes(unsigned int x)
+{
+    // Número de soluções:
+    T n_sol = 0;
+
+    // Se não cabe em uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cerr << "Erro. O número de possibilidades deve estar entre 1 e " << X_MAX << "." << std::endl;
+        return n_sol;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+
+    // Estados de cada posição:
+    std::vector<estado_de_bits> P(x);
+
+    // Inicia a primeira posição com todas as possibilidades:
+    P[0] = {0, 0, 0, omega};
+
+    // Índice de profundidade:
+    unsigned int i = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Se é a posição de fim de solução:
+        if(i == x-1)
+        {
+            // Cada possibilidade livre completa uma solução:
+            n_sol += __builtin_popcountll(P[i].livres);
+            P[i].livres = 0;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+    }
+
+    // Retorna o número de soluções:
+    return n_sol;
+}
+
+// n: natural de 128 bits.
+// Retorna a representação decimal de n (o std::ostream não imprime 128 bits):
+std::string natural_em_decimal(contador128 n)
+{
+    // Se nulo:
+    if(!n)
+    {
+        return "0";
+    }
+    // Dígitos em ordem inversa:
+    std::string s;
+    while(n)
+    {
+        s.insert(s.begin(), char('0' + int(n%10)));
+        n /= 10;
+    }
+    return s;
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Largura do contador:
+    unsigned int bits;
+    std::cout << "Entre com uma largura de contador desejada (64 ou 128): ";
+    std::cin >> bits;
+
+    // Número de soluções em decimal:
+    std::string n_sol;
+    // Se deseja contador de 128 bits:
+    if(bits == 128)
+    {
+        n_sol = natural_em_decimal(conta_solucoes<contador128>(x));
+    } else
+    { // Senão, usa 64 bits:
+        n_sol = std::to_string(conta_solucoes<unsigned long long>(x));
+    }
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol << std::endl;
+    return 0;
+}
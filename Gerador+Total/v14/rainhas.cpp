@@ -0,0 +1,175 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -march=native
+// Observação: -march=native habilita AVX2/AVX-512 (se disponíveis) na
+// validação das soluções em lotes.
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+#include "../../Biblioteca/sumidouro.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX 64
+// Número de soluções por lote entregue à validação:
+#define SOLUCOES_POR_LOTE 1024
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades:
+    if(x == X_MAX)
+    {
+        // Retorna a palavra cheia:
+        return ~uint64_t(0);
+    }
+    // Retorna os x bits menos significativos:
+    return (uint64_t(1) << x) - 1;
+}
+
+// x    : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// s    : destino das soluções.
+// Retorna falso se o destino interrompeu a geração:
+bool gera_solucoes(unsigned int x, Sumidouro& s)
+{
+    // Se não cabe em uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cerr << "Erro. O número de possibilidades deve estar entre 1 e " << X_MAX << "." << std::endl;
+        s.finaliza();
+        return true;
+    }
+
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(x);
+
+    // Estados de cada posição:
+    std::vector<estado_de_bits> P(x);
+
+    // Solução parcial:
+    std::vector<unsigned int> S(x);
+
+    // Inicia a primeira posição com todas as possibilidades:
+    P[0] = {0, 0, 0, omega};
+
+    // Índice de profundidade:
+    unsigned int i = 0;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!P[i].livres)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!i)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            i--;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = P[i].livres & (~P[i].livres + 1);
+        // Marca a possibilidade como testada:
+        P[i].livres ^= bit;
+        // Salva a coordenada na solução parcial:
+        S[i] = __builtin_ctzll(bit);
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(i == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, S.data()))
+            {
+                s.finaliza();
+                return false;
+            }
+            continue;
+        }
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = P[i].colunas | bit;
+        uint64_t d = (P[i].diagonais | bit) << 1;
+        uint64_t a = (P[i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        i++;
+        P[i] = {c, d, a, omega & ~(c | d | a)};
+    }
+
+    s.finaliza();
+    return true;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas;
+// n_des    : número de soluções desejadas (0 para todas).
+// Mantém o contrato dos geradores anteriores:
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, unsigned int n_des)
+{
+    SumidouroDeConjunto s(n_sol, R, n_des);
+    gera_solucoes(x, s);
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Quantidade de soluções desejadas:
+    unsigned long long n_des;
+    std::cout << "Entre com um número de soluções desejado (0 para todas): ";
+    std::cin >> n_des;
+
+    // Número de soluções:
+    unsigned long long n_sol = 0;
+    // Número de falsas soluções:
+    unsigned long long n_f_sol = 0;
+
+    // Valida as soluções em lotes, à medida que são geradas (sem armazená-las):
+    SumidouroDeLotes s(SOLUCOES_POR_LOTE, [&](unsigned int x, unsigned int n, const unsigned int* lote)
+    {
+        // Soluções do lote até o número desejado:
+        unsigned long long m = n;
+        if(n_des && n_des - n_sol < m)
+        {
+            m = n_des - n_sol;
+        }
+        n_sol += m;
+        // Conta as falsas soluções do lote de uma vez:
+        n_f_sol += verifica_lote(x, m, lote);
+        // Continua enquanto não encontrou o número de soluções desejado:
+        return !n_des || n_sol < n_des;
+    });
+    // Gera as soluções:
+    gera_solucoes(x, s);
+
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+    return 0;
+}
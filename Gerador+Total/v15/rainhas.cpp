@@ -0,0 +1,53 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -march=native
+// Observação: -march=native habilita AVX2/AVX-512 (se disponíveis) na
+// validação das soluções em lotes.
+
+#include <iostream>
+
+#include "../../Biblioteca/armazem.hpp"
+#include "../../Biblioteca/gerador_de_bits.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+// Número de soluções por lote entregue à validação:
+#define SOLUCOES_POR_LOTE 1024
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX_DE_BITS)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX_DE_BITS << "." << std::endl;
+        return 0;
+    }
+
+    // Conjunto de soluções empacotadas:
+    ArmazemDeSolucoes A(x);
+    // Gera as soluções diretamente no armazém:
+    gera_solucoes_de_bits(x, A);
+
+    // Número de falsas soluções:
+    unsigned long long n_f_sol = 0;
+    // Valida as supostas soluções do armazém em lotes desempacotados:
+    SumidouroDeLotes s(SOLUCOES_POR_LOTE, [&](unsigned int x, unsigned int n, const unsigned int* lote)
+    {
+        n_f_sol += verifica_lote(x, n, lote);
+        return true;
+    });
+    A.percorre(s);
+
+    // Memória estimada do formato anterior (um ponteiro e um vetor de x naturais
+    // por solução, mais o cabeçalho de cada alocação, de tipicamente 16 bytes):
+    unsigned long long bytes_anteriores = A.tamanho()*(sizeof(unsigned int*) + sizeof(unsigned int)*x + 16);
+
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << A.tamanho()-n_f_sol << std::endl;
+    std::cout << "Memória do armazém (" << A.bits() << " bits por coordenada): " << A.bytes() << " bytes." << std::endl;
+    std::cout << "Memória estimada do formato anterior: " << bytes_anteriores << " bytes." << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -march=native
+// Observação: -march=native habilita AVX2/AVX-512 (se disponíveis) na
+// validação das soluções em lotes.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../../Biblioteca/arquivo.hpp"
+#include "../../Biblioteca/gerador_de_bits.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+// Número de soluções por lote entregue à validação:
+#define SOLUCOES_POR_LOTE 1024
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX_DE_BITS)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX_DE_BITS << "." << std::endl;
+        return 0;
+    }
+
+    // Arquivo de soluções do tabuleiro:
+    std::string nome = "rainhas-" + std::to_string(x) + ".bin";
+    // Leitor do arquivo:
+    LeitorDeArquivo L;
+
+    // Se o arquivo não existe, é de outro tabuleiro ou não tem todas as soluções
+    // (como o de uma única solução construída), gera as soluções nele:
+    if(!L.abre(nome.c_str()) || L.x() != x || !L.completa())
+    {
+        // Profundidade do índice de prefixos:
+        unsigned int k;
+        std::cout << "Entre com uma profundidade de índice de prefixos desejada: ";
+        std::cin >> k;
+
+        std::cout << "Gerando " << nome << "..." << std::endl;
+        EscritorDeArquivo E(x, k);
+        if(!E.abre(nome.c_str()))
+        {
+            return 0;
+        }
+        // A enumeração só é interrompida se a escrita falha, e então o arquivo
+        // não é gravado; se é gravado, tem todas as soluções:
+        E.marca_completa();
+        gera_solucoes_de_bits(x, E);
+        // Mapeia o arquivo gerado (se foi gravado por inteiro):
+        if(!E.gravou() || !L.abre(nome.c_str()))
+        {
+            return 0;
+        }
+    } else
+    { // Senão, apenas mapeou o arquivo existente:
+        std::cout << "Mapeado " << nome << " (sem recomputar)." << std::endl;
+    }
+
+    // Número de falsas soluções:
+    unsigned long long n_f_sol = 0;
+    // Valida as soluções do mapeamento em lotes:
+    SumidouroDeLotes s(SOLUCOES_POR_LOTE, [&](unsigned int x, unsigned int n, const unsigned int* lote)
+    {
+        n_f_sol += verifica_lote(x, n, lote);
+        return true;
+    });
+    L.percorre(s, 0, L.tamanho());
+
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << L.tamanho()-n_f_sol << std::endl;
+
+    // Se há índice de prefixos:
+    if(L.profundidade_do_indice())
+    {
+        std::cout << "Índice de " << L.prefixos() << " prefixos de profundidade " << L.profundidade_do_indice() << ":" << std::endl;
+        // Prefixo de uma entrada:
+        std::vector<unsigned int> P(L.profundidade_do_indice());
+        unsigned long long primeiro, quantidade;
+        // Para todas as entradas (no máximo 16, para não poluir a saída):
+        for(unsigned long long e = 0; e < L.prefixos() && e < 16; e++)
+        {
+            L.entrada(e, P.data(), &primeiro, &quantidade);
+            std::cout << "[";
+            for(unsigned int i = 0; i < P.size(); i++)
+            {
+                std::cout << P[i] << (i+1 < P.size() ? ", " : "");
+            }
+            std::cout << "] --> soluções " << primeiro << " a " << primeiro+quantidade-1 << std::endl;
+        }
+    }
+    return 0;
+}
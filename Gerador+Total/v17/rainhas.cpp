@@ -0,0 +1,244 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+#if defined(_WIN32)
+#include <windows.h> // MoveFileExA
+#endif
+
+// Maior número de possibilidades suportado (bits de uma palavra de máquina):
+#define X_MAX 64
+// Identificação do arquivo de ponto de controle:
+#define MAGICA_DE_PONTO_DE_CONTROLE "RAINHASC"
+// Número de nós entre consultas ao relógio:
+#define NOS_POR_CONSULTA_AO_RELOGIO (1u << 16)
+
+// Estrutura de estado de uma profundidade da busca, em que cada
+// bit de uma palavra representa uma possibilidade de coordenada:
+typedef struct EstadoDeBits
+{
+    uint64_t colunas;       // possibilidades usadas por rainhas anteriores.
+    uint64_t diagonais;     // possibilidades atacadas por diagonais (projetadas na posição).
+    uint64_t antidiagonais; // possibilidades atacadas por antidiagonais (projetadas na posição).
+    uint64_t livres;        // possibilidades ainda não testadas na posição.
+} estado_de_bits;
+
+// Estado completo de uma busca em andamento. Os estados das posições
+// 0..i substituem a pilha, o espaço de possibilidades e a memória de
+// remoções da versão 8, então bastam para retomar a busca exatamente:
+typedef struct Busca
+{
+    unsigned int x;                 // número de possibilidades.
+    unsigned int i;                 // índice de profundidade atual.
+    unsigned long long n_sol;       // soluções contadas até agora.
+    unsigned long long nos;         // nós visitados até agora.
+    std::vector<estado_de_bits> P;  // estados de cada posição.
+} busca;
+
+// Intervalos entre pontos de controle (zero desativa o critério):
+typedef struct Intervalos
+{
+    double segundos;
+    unsigned long long nos;
+} intervalos;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço.
+uint64_t mascara_de_possibilidades(unsigned int x)
+{
+    // Se todos os bits da palavra são possibilidades:
+    if(x == X_MAX)
+    {
+        // Retorna a palavra cheia:
+        return ~uint64_t(0);
+    }
+    // Retorna os x bits menos significativos:
+    return (uint64_t(1) << x) - 1;
+}
+
+// B    : busca;
+// nome : caminho do arquivo de ponto de controle.
+// Escreve em um arquivo temporário e o renomeia, para que uma queda
+// durante a escrita não estrague o ponto de controle anterior:
+bool salva_ponto_de_controle(const busca& B, const std::string& nome)
+{
+    std::string temporario = nome + ".tmp";
+    FILE* f = std::fopen(temporario.c_str(), "wb");
+    if(f == NULL)
+    {
+        std::cerr << "Erro ao criar o arquivo " << temporario << "." << std::endl;
+        return false;
+    }
+    bool ok = std::fwrite(MAGICA_DE_PONTO_DE_CONTROLE, 8, 1, f) == 1
+                && std::fwrite(&B.x, sizeof(B.x), 1, f) == 1
+                && std::fwrite(&B.i, sizeof(B.i), 1, f) == 1
+                && std::fwrite(&B.n_sol, sizeof(B.n_sol), 1, f) == 1
+                && std::fwrite(&B.nos, sizeof(B.nos), 1, f) == 1
+                && std::fwrite(B.P.data(), sizeof(estado_de_bits), B.i+1, f) == B.i+1;
+    ok = (std::fclose(f) == 0) && ok;
+    // Substitui o ponto de controle anterior (no Windows, rename falha se o
+    // destino existe, então a substituição é pedida explicitamente):
+#if defined(_WIN32)
+    ok = ok && MoveFileExA(temporario.c_str(), nome.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    ok = ok && !std::rename(temporario.c_str(), nome.c_str());
+#endif
+    if(!ok)
+    {
+        std::cerr << "Erro ao salvar o ponto de controle em " << nome << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// B    : busca (com x já definido);
+// nome : caminho do arquivo de ponto de controle.
+// Retorna falso se não há ponto de controle válido para x:
+bool carrega_ponto_de_controle(busca& B, const std::string& nome)
+{
+    FILE* f = std::fopen(nome.c_str(), "rb");
+    if(f == NULL)
+    {
+        return false;
+    }
+    char magica[8];
+    unsigned int x;
+    bool ok = std::fread(magica, 8, 1, f) == 1 && !std::memcmp(magica, MAGICA_DE_PONTO_DE_CONTROLE, 8)
+                && std::fread(&x, sizeof(x), 1, f) == 1 && x == B.x
+                && std::fread(&B.i, sizeof(B.i), 1, f) == 1 && B.i < B.x
+                && std::fread(&B.n_sol, sizeof(B.n_sol), 1, f) == 1
+                && std::fread(&B.nos, sizeof(B.nos), 1, f) == 1
+                && std::fread(B.P.data(), sizeof(estado_de_bits), B.i+1, f) == B.i+1;
+    std::fclose(f);
+    return ok;
+}
+
+// B    : busca (nova ou retomada);
+// I    : intervalos entre pontos de controle;
+// nome : caminho do arquivo de ponto de controle.
+// Conta as soluções a partir do estado de B, salvando pontos de controle:
+void conta_solucoes(busca& B, const intervalos& I, const std::string& nome)
+{
+    // Possibilidades de coordenadas de posicionamento das rainhas:
+    uint64_t omega = mascara_de_possibilidades(B.x);
+    // Momento e nó do último ponto de controle:
+    auto ultimo = std::chrono::steady_clock::now();
+    unsigned long long nos_do_ultimo = B.nos;
+
+    // Enquanto houver estados:
+    while(true)
+    {
+        // Se esgotou as possibilidades da posição atual:
+        if(!B.P[B.i].livres)
+        {
+            // Se é a primeira posição, terminou a busca:
+            if(!B.i)
+            {
+                break;
+            }
+            // Volta para a posição anterior:
+            B.i--;
+            continue;
+        }
+
+        // Se é a posição de fim de solução:
+        if(B.i == B.x-1)
+        {
+            // Cada possibilidade livre completa uma solução:
+            B.n_sol += __builtin_popcountll(B.P[B.i].livres);
+            B.nos += __builtin_popcountll(B.P[B.i].livres);
+            B.P[B.i].livres = 0;
+            continue;
+        }
+
+        // Isola a menor possibilidade livre:
+        uint64_t bit = B.P[B.i].livres & (~B.P[B.i].livres + 1);
+        // Marca a possibilidade como testada:
+        B.P[B.i].livres ^= bit;
+        B.nos++;
+
+        // Projeta os ataques da (i+1)-ésima rainha na posição seguinte:
+        uint64_t c = B.P[B.i].colunas | bit;
+        uint64_t d = (B.P[B.i].diagonais | bit) << 1;
+        uint64_t a = (B.P[B.i].antidiagonais | bit) >> 1;
+        // Avança para a posição seguinte com as possibilidades não atacadas:
+        B.i++;
+        B.P[B.i] = {c, d, a, omega & ~(c | d | a)};
+
+        // Se atingiu o intervalo em nós:
+        bool salva = I.nos && B.nos - nos_do_ultimo >= I.nos;
+        // Se é hora de consultar o relógio e atingiu o intervalo em segundos:
+        if(!salva && I.segundos > 0 && !(B.nos % NOS_POR_CONSULTA_AO_RELOGIO))
+        {
+            salva = std::chrono::duration<double>(std::chrono::steady_clock::now()-ultimo).count() >= I.segundos;
+        }
+        // Se deve salvar um ponto de controle:
+        if(salva)
+        {
+            salva_ponto_de_controle(B, nome);
+            ultimo = std::chrono::steady_clock::now();
+            nos_do_ultimo = B.nos;
+        }
+    }
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo ou maior que uma palavra:
+    if(!x || x > X_MAX)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX << "." << std::endl;
+        return 0;
+    }
+
+    // Intervalos entre pontos de controle:
+    intervalos I;
+    std::cout << "Entre com um intervalo entre pontos de controle em segundos (0 para nenhum): ";
+    std::cin >> I.segundos;
+    std::cout << "Entre com um intervalo entre pontos de controle em nós (0 para nenhum): ";
+    std::cin >> I.nos;
+
+    // Arquivo de ponto de controle do tabuleiro:
+    std::string nome = "rainhas-" + std::to_string(x) + ".ponto";
+
+    // Busca:
+    busca B;
+    B.x = x;
+    B.P.resize(x);
+
+    // Se há ponto de controle, pergunta se retoma:
+    unsigned int retoma = 0;
+    if(carrega_ponto_de_controle(B, nome))
+    {
+        std::cout << "Entre com 1 para retomar do ponto de controle em " << nome << " (" << B.n_sol
+                    << " soluções, " << B.nos << " nós) ou 0 para recomeçar: ";
+        std::cin >> retoma;
+    }
+    // Se não retoma, inicia a primeira posição com todas as possibilidades:
+    if(!retoma)
+    {
+        B.i = 0;
+        B.n_sol = 0;
+        B.nos = 0;
+        B.P[0] = {0, 0, 0, mascara_de_possibilidades(x)};
+    }
+
+    // Conta as soluções:
+    conta_solucoes(B, I, nome);
+    // Terminou, então o ponto de controle não é mais necessário:
+    std::remove(nome.c_str());
+
+    std::cout << "Número de nós visitados: " << B.nos << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << B.n_sol << std::endl;
+    return 0;
+}
@@ -0,0 +1,468 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2 -pthread
+// Para executar um único fragmento (como o fazem os processos lançados
+// localmente, ou em outras máquinas com um sistema de arquivos comum):
+// rainhas.exe fragmento <x> <k> <m> <i> <salva soluções (0 ou 1)>
+// (com i de 1 a m, como nos nomes de arquivo e nas mensagens)
+// Se os fragmentos salvam as soluções, a junção as reúne em rainhas-<x>.bin,
+// o mesmo arquivo de todas as soluções da versão 16.
+
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "../../Biblioteca/arquivo.hpp"
+#include "../../Biblioteca/gerador_de_bits.hpp"
+
+// Identificação e versão do arquivo de resultado de um fragmento:
+#define MAGICA_DE_FRAGMENTO "RAINHAS-FRAGMENTO"
+#define VERSAO_DE_FRAGMENTO 1
+
+// Resultado de um fragmento da busca: o fragmento i (de 0 a m-1) é dono
+// dos prefixos de k rainhas de índice e (na ordem da busca) com e % m == i:
+typedef struct Fragmento
+{
+    unsigned int x;                             // número de possibilidades.
+    unsigned int k;                             // número de coordenadas dos prefixos.
+    unsigned int m;                             // número de fragmentos.
+    unsigned int i;                             // índice do fragmento.
+    unsigned long long n_prefixos;              // número total de prefixos da busca.
+    std::vector<unsigned long long> prefixos;   // índices dos prefixos do fragmento.
+    std::vector<unsigned long long> contagens;  // soluções de cada prefixo do fragmento.
+    unsigned long long total;                   // soluções do fragmento.
+} fragmento;
+
+// x, k, m, i: como em fragmento;
+// extensao  : extensão do arquivo.
+std::string nome_de_fragmento(unsigned int x, unsigned int k, unsigned int m, unsigned int i, const std::string& extensao)
+{
+    return "rainhas-" + std::to_string(x) + "-" + std::to_string(k) + "-" + std::to_string(i+1)
+                + "-de-" + std::to_string(m) + "." + extensao;
+}
+
+// x, k, m, i: como em fragmento;
+// salva     : se as soluções do fragmento devem ser salvas em arquivo.
+// Executa o fragmento e escreve seu resultado. O resultado é escrito em um
+// arquivo temporário e renomeado, então só existe se o fragmento terminou:
+bool executa_fragmento(unsigned int x, unsigned int k, unsigned int m, unsigned int i, bool salva)
+{
+    fragmento F = {x, k, m, i, 0, {}, {}, 0};
+    // Prefixos da busca:
+    std::vector<unsigned int> P = prefixos_de_bits(x, k);
+    F.n_prefixos = P.size()/k;
+
+    // Arquivo de soluções do fragmento (indexado pelos prefixos):
+    EscritorDeArquivo E(x, k);
+    if(salva && !E.abre(nome_de_fragmento(x, k, m, i, "bin").c_str()))
+    {
+        return false;
+    }
+
+    // Soluções do prefixo atual:
+    unsigned long long n_sol;
+    // Conta as soluções (e as repassa ao arquivo, se salva):
+    SumidouroDeFuncao s([&](unsigned int x, const unsigned int* S)
+    {
+        n_sol++;
+        return !salva || E.recebe(x, S);
+    });
+
+    // Para todos os prefixos do fragmento:
+    for(unsigned long long e = i; e < F.n_prefixos; e += m)
+    {
+        n_sol = 0;
+        gera_solucoes_de_bits_a_partir(x, k, P.data() + e*k, s);
+        F.prefixos.push_back(e);
+        F.contagens.push_back(n_sol);
+        F.total += n_sol;
+    }
+    // Completa o arquivo de soluções:
+    if(salva)
+    {
+        E.finaliza();
+        // Se a escrita falhou, o fragmento não termina (e será reexecutado):
+        if(!E.gravou())
+        {
+            return false;
+        }
+    }
+
+    // Escreve o resultado:
+    std::string nome = nome_de_fragmento(x, k, m, i, "fragmento");
+    std::string temporario = nome + ".tmp";
+    {
+        std::ofstream f(temporario);
+        f << MAGICA_DE_FRAGMENTO << " " << VERSAO_DE_FRAGMENTO << "\n";
+        f << F.x << " " << F.k << " " << F.m << " " << F.i << "\n";
+        f << F.n_prefixos << " " << F.prefixos.size() << "\n";
+        for(size_t j = 0; j < F.prefixos.size(); j++)
+        {
+            f << F.prefixos[j] << " " << F.contagens[j] << "\n";
+        }
+        f << "fim " << F.total << "\n";
+        if(!f.flush())
+        {
+            std::cerr << "Erro ao escrever o arquivo " << temporario << "." << std::endl;
+            return false;
+        }
+    }
+    if(std::rename(temporario.c_str(), nome.c_str()))
+    {
+        std::cerr << "Erro ao renomear o arquivo " << temporario << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// nome : caminho do arquivo de resultado;
+// F    : fragmento lido.
+// Retorna falso se o arquivo não existe ou está incompleto ou inconsistente:
+bool le_fragmento(const std::string& nome, fragmento& F)
+{
+    std::ifstream f(nome);
+    std::string magica, fim;
+    unsigned int versao;
+    size_t n;
+    if(!(f >> magica >> versao) || magica != MAGICA_DE_FRAGMENTO || versao != VERSAO_DE_FRAGMENTO)
+    {
+        return false;
+    }
+    if(!(f >> F.x >> F.k >> F.m >> F.i >> F.n_prefixos >> n))
+    {
+        return false;
+    }
+    F.prefixos.resize(n);
+    F.contagens.resize(n);
+    // Soma das contagens dos prefixos:
+    unsigned long long soma = 0;
+    for(size_t j = 0; j < n; j++)
+    {
+        if(!(f >> F.prefixos[j] >> F.contagens[j]))
+        {
+            return false;
+        }
+        soma += F.contagens[j];
+    }
+    // O total deve conferir com a soma:
+    return (f >> fim >> F.total) && fim == "fim" && F.total == soma;
+}
+
+// F: resultado lido de um fragmento.
+// Retorna verdadeiro se o arquivo de soluções do fragmento existe, é válido,
+// está indexado pelos prefixos e tem as F.total soluções contadas:
+bool solucoes_conferem(const fragmento& F)
+{
+    LeitorDeArquivo L;
+    return L.abre(nome_de_fragmento(F.x, F.k, F.m, F.i, "bin").c_str()) && L.x() == F.x
+            && L.profundidade_do_indice() == F.k && L.tamanho() == F.total;
+}
+
+// x, k, m: como em fragmento;
+// salva  : se os arquivos de soluções dos fragmentos também são juntados;
+// total  : soluções de todos os fragmentos.
+// Junta os resultados dos m fragmentos, verificando que cada prefixo da
+// busca foi contado exatamente uma vez (e, se salva, que o arquivo de
+// soluções de cada fragmento confere com sua contagem). Retorna falso se a
+// cobertura é incompleta (e informa quais fragmentos devem ser reexecutados):
+bool junta_fragmentos(unsigned int x, unsigned int k, unsigned int m, bool salva, unsigned long long& total)
+{
+    // Número de prefixos da busca:
+    unsigned long long n_prefixos = prefixos_de_bits(x, k).size()/k;
+    // Número de vezes que cada prefixo foi contado:
+    std::vector<unsigned int> coberto(n_prefixos, 0);
+    // Se a junção é válida:
+    bool ok = true;
+    total = 0;
+
+    // Para todos os fragmentos:
+    for(unsigned int i = 0; i < m; i++)
+    {
+        std::string nome = nome_de_fragmento(x, k, m, i, "fragmento");
+        fragmento F;
+        // Se o resultado não existe, está incompleto ou é de outra busca:
+        if(!le_fragmento(nome, F) || F.x != x || F.k != k || F.m != m || F.i != i || F.n_prefixos != n_prefixos)
+        {
+            std::cout << "Fragmento " << i+1 << " de " << m << " ausente ou inválido (" << nome << "): reexecute-o." << std::endl;
+            ok = false;
+            continue;
+        }
+        // Se as soluções do fragmento não foram salvas por inteiro:
+        if(salva && !solucoes_conferem(F))
+        {
+            std::cout << "Fragmento " << i+1 << " de " << m << " sem arquivo de soluções válido ("
+                        << nome_de_fragmento(x, k, m, i, "bin") << "): reexecute-o salvando as soluções." << std::endl;
+            ok = false;
+        }
+        // Marca os prefixos do fragmento:
+        for(size_t j = 0; j < F.prefixos.size(); j++)
+        {
+            if(F.prefixos[j] >= n_prefixos)
+            {
+                std::cout << "Fragmento " << i+1 << " tem prefixo inexistente " << F.prefixos[j] << "." << std::endl;
+                ok = false;
+                continue;
+            }
+            coberto[F.prefixos[j]]++;
+        }
+        total += F.total;
+    }
+
+    // Verifica a cobertura dos prefixos:
+    unsigned long long faltantes = 0, repetidos = 0;
+    for(unsigned long long e = 0; e < n_prefixos; e++)
+    {
+        faltantes += !coberto[e];
+        repetidos += coberto[e] > 1;
+    }
+    std::cout << "Prefixos de " << k << " rainhas: " << n_prefixos << " (faltantes: " << faltantes
+                << ", repetidos: " << repetidos << ")." << std::endl;
+    return ok && !faltantes && !repetidos;
+}
+
+// x, k, m: como em fragmento;
+// total  : soluções de todos os fragmentos (já conferidas com seus arquivos).
+// Junta os arquivos de soluções dos fragmentos em rainhas-<x>.bin, prefixo a
+// prefixo na ordem da busca (então o resultado é o mesmo da enumeração
+// completa, com índice de prefixos de profundidade k). Retorna falso se não
+// conseguiu ler os fragmentos ou gravar o arquivo:
+bool junta_solucoes(unsigned int x, unsigned int k, unsigned int m, unsigned long long total)
+{
+    // Prefixos da busca:
+    std::vector<unsigned int> P = prefixos_de_bits(x, k);
+    unsigned long long n_prefixos = P.size()/k;
+
+    // Arquivos dos fragmentos, mapeados ao mesmo tempo:
+    std::vector<LeitorDeArquivo> L(m);
+    for(unsigned int i = 0; i < m; i++)
+    {
+        if(!L[i].abre(nome_de_fragmento(x, k, m, i, "bin").c_str()))
+        {
+            std::cerr << "Erro ao abrir o arquivo " << nome_de_fragmento(x, k, m, i, "bin") << "." << std::endl;
+            return false;
+        }
+    }
+
+    // Arquivo de todas as soluções:
+    std::string nome = "rainhas-" + std::to_string(x) + ".bin";
+    EscritorDeArquivo E(x, k);
+    if(!E.abre(nome.c_str()))
+    {
+        return false;
+    }
+    // Solução copiada e número de soluções copiadas:
+    std::vector<unsigned int> S(x);
+    unsigned long long copiadas = 0;
+    // Para todos os prefixos (o prefixo e é do fragmento e % m):
+    for(unsigned long long e = 0; e < n_prefixos; e++)
+    {
+        unsigned long long primeiro, quantidade;
+        // Se o prefixo não tem soluções, não está no índice do fragmento:
+        if(!L[e%m].busca_prefixo(P.data() + e*k, &primeiro, &quantidade))
+        {
+            continue;
+        }
+        // Copia as soluções do prefixo:
+        for(unsigned long long q = primeiro; q < primeiro+quantidade; q++)
+        {
+            L[e%m].desempacota(q, S.data());
+            if(!E.recebe(x, S.data()))
+            {
+                break;
+            }
+            copiadas++;
+        }
+    }
+    // Só marca o arquivo como completo se copiou todas as soluções contadas:
+    if(copiadas == total)
+    {
+        E.marca_completa();
+    } else
+    {
+        std::cerr << "Erro. Foram copiadas " << copiadas << " de " << total << " soluções para " << nome << "." << std::endl;
+    }
+    E.finaliza();
+    return E.gravou() && copiadas == total;
+}
+
+// programa : caminho deste programa;
+// x, k, m  : como em fragmento;
+// salva    : se as soluções dos fragmentos devem ser salvas em arquivo.
+// Lança um processo por fragmento ainda sem resultado válido (ou, se salva,
+// sem arquivo de soluções que confira com o resultado) e espera todos
+// terminarem (os fragmentos já concluídos não são reexecutados):
+void executa_localmente(const std::string& programa, unsigned int x, unsigned int k, unsigned int m, bool salva)
+{
+    // Uma linha de execução por processo lançado:
+    std::vector<std::thread> processos;
+    for(unsigned int i = 0; i < m; i++)
+    {
+        fragmento F;
+        // Se o fragmento já foi concluído (e salvou as soluções, se pedido):
+        if(le_fragmento(nome_de_fragmento(x, k, m, i, "fragmento"), F) && F.x == x && F.k == k && F.m == m && F.i == i
+            && (!salva || solucoes_conferem(F)))
+        {
+            continue;
+        }
+        std::string comando = "\"" + programa + "\" fragmento " + std::to_string(x) + " " + std::to_string(k) + " "
+                                + std::to_string(m) + " " + std::to_string(i+1) + " " + (salva ? "1" : "0");
+        processos.emplace_back([comando, i]()
+        {
+            if(std::system(comando.c_str()))
+            {
+                std::cerr << "Erro na execução do fragmento " << i+1 << "." << std::endl;
+            }
+        });
+    }
+    for(auto& p : processos)
+    {
+        p.join();
+    }
+}
+
+// x, k, m: como em fragmento.
+bool parametros_validos(unsigned int x, unsigned int k, unsigned int m)
+{
+    if(!x || x > X_MAX_DE_BITS)
+    {
+        std::cerr << "Erro. O número de possibilidades deve ser um natural não nulo e no máximo " << X_MAX_DE_BITS << "." << std::endl;
+        return false;
+    }
+    if(!k || k > x)
+    {
+        std::cerr << "Erro. O número de coordenadas dos prefixos deve estar entre 1 e " << x << "." << std::endl;
+        return false;
+    }
+    if(!m)
+    {
+        std::cerr << "Erro. O número de fragmentos deve ser um natural não nulo." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// texto : argumento da linha de comando;
+// v     : natural lido.
+// Retorna falso se o argumento não é um natural de 32 bits:
+bool le_natural(const char* texto, unsigned int& v)
+{
+    try
+    {
+        size_t fim;
+        unsigned long r = std::stoul(texto, &fim);
+        if(texto[fim] || r > 0xFFFFFFFFul || texto[0] == '-')
+        {
+            return false;
+        }
+        v = (unsigned int)r;
+        return true;
+    } catch(const std::exception&)
+    {
+        return false;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Se é a execução de um único fragmento por linha de comando:
+    if(argc > 1)
+    {
+        unsigned int x, k, m, i;
+        if(argc != 7 || std::string(argv[1]) != "fragmento" || !le_natural(argv[2], x) || !le_natural(argv[3], k)
+            || !le_natural(argv[4], m) || !le_natural(argv[5], i))
+        {
+            std::cerr << "Uso: " << argv[0] << " fragmento <x> <k> <m> <i de 1 a m> <salva soluções (0 ou 1)>" << std::endl;
+            return 1;
+        }
+        if(!parametros_validos(x, k, m))
+        {
+            return 1;
+        }
+        if(!i || i > m)
+        {
+            std::cerr << "Erro. O índice do fragmento deve estar entre 1 e " << m << "." << std::endl;
+            return 1;
+        }
+        return executa_fragmento(x, k, m, i-1, std::string(argv[6]) == "1") ? 0 : 1;
+    }
+
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+    // Número de coordenadas dos prefixos:
+    unsigned int k;
+    std::cout << "Entre com um número de coordenadas dos prefixos desejado: ";
+    std::cin >> k;
+    // Número de fragmentos:
+    unsigned int m;
+    std::cout << "Entre com um número de fragmentos desejado: ";
+    std::cin >> m;
+    if(!parametros_validos(x, k, m))
+    {
+        return 0;
+    }
+
+    // Operação:
+    unsigned int modo;
+    std::cout << "Entre com 1 para executar um fragmento, 2 para executar os fragmentos pendentes localmente ou 3 para juntar os fragmentos: ";
+    std::cin >> modo;
+
+    // Se executa um ou todos os fragmentos, pergunta se salva as soluções:
+    unsigned int salva = 0;
+    if(modo == 1 || modo == 2)
+    {
+        std::cout << "Entre com 1 para salvar as soluções dos fragmentos em arquivo ou 0 para apenas contá-las: ";
+        std::cin >> salva;
+    } else if(modo == 3)
+    { // Se só junta, pergunta se junta também as soluções salvas:
+        std::cout << "Entre com 1 para juntar também as soluções salvas dos fragmentos ou 0 para juntar só as contagens: ";
+        std::cin >> salva;
+    }
+
+    if(modo == 1)
+    {
+        // Índice do fragmento:
+        unsigned int i;
+        std::cout << "Entre com o índice do fragmento (de 1 a " << m << "): ";
+        std::cin >> i;
+        if(!i || i > m)
+        {
+            std::cerr << "Erro. Índice de fragmento inválido." << std::endl;
+            return 0;
+        }
+        if(executa_fragmento(x, k, m, i-1, salva))
+        {
+            std::cout << "Fragmento salvo em " << nome_de_fragmento(x, k, m, i-1, "fragmento") << "." << std::endl;
+        }
+        return 0;
+    }
+    if(modo == 2)
+    {
+        executa_localmente(argv[0], x, k, m, salva);
+    } else if(modo != 3)
+    {
+        std::cerr << "Erro. Operação inválida." << std::endl;
+        return 0;
+    }
+
+    // Junta os fragmentos:
+    unsigned long long total;
+    if(junta_fragmentos(x, k, m, salva, total))
+    {
+        std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << total << std::endl;
+        // Junta as soluções salvas:
+        if(salva && junta_solucoes(x, k, m, total))
+        {
+            std::cout << "Soluções juntadas em rainhas-" << x << ".bin." << std::endl;
+        }
+    } else
+    {
+        std::cout << "Cobertura incompleta. Soluções dos fragmentos válidos: " << total << std::endl;
+    }
+    return 0;
+}
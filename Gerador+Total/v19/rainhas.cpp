@@ -0,0 +1,101 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+
+#include "../../Biblioteca/cobertura_exata.hpp"
+#include "../../Biblioteca/sumidouro.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas;
+// fixas    : rainhas posicionadas previamente.
+// Mantém a interface das versões anteriores, com o gerador por cobertura exata:
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R, const std::vector<casa>& fixas = {})
+{
+    SumidouroDeConjunto s(n_sol, R);
+    gera_solucoes_por_cobertura(x, s, fixas);
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo:
+    if(!x)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        return 0;
+    }
+
+    // Rainhas posicionadas previamente:
+    unsigned int n_fixas;
+    std::cout << "Entre com um número de rainhas posicionadas previamente: ";
+    std::cin >> n_fixas;
+    std::vector<casa> fixas(n_fixas);
+    for(unsigned int k = 0; k < n_fixas; k++)
+    {
+        std::cout << "Entre com a linha e a coluna da " << k+1 << "ª rainha (de 0 a " << x-1 << "): ";
+        std::cin >> fixas[k].i >> fixas[k].v;
+    }
+
+    // Operação:
+    unsigned int modo;
+    std::cout << "Entre com 1 para apenas contar as soluções ou 2 para gerá-las: ";
+    std::cin >> modo;
+
+    auto inicio = std::chrono::steady_clock::now();
+    if(modo == 1)
+    {
+        // Conta as soluções:
+        unsigned long long n = conta_solucoes_por_cobertura(x, fixas);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+        std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n << std::endl;
+        std::cout << "Tempo: " << t << " s." << std::endl;
+        return 0;
+    }
+
+    // Conjunto de soluções:
+    unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
+    // Número de soluções:
+    unsigned int n_sol = 0;
+    // Gera as soluções:
+    gera_solucoes(x, &n_sol, &R, fixas);
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+
+    // Número de falsas soluções (inclusive as que não respeitam as rainhas fixas):
+    unsigned int n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        bool respeita = true;
+        for(auto f : fixas)
+        {
+            respeita = respeita && R[i][f.i] == f.v;
+        }
+        // Se não for de fato solução:
+        if(!respeita || !eh_solucao_de_bits(x, R[i]))
+        {
+            n_f_sol++;
+        }
+    }
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+    std::cout << "Tempo: " << t << " s." << std::endl;
+
+    // Libera a memória alocada:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Libera a (i+1)-ésima solução:
+        free(R[i]);
+    }
+    free(R);
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Para compilar:
+// g++ rainhas.cpp ../../Biblioteca/rainhas.cpp -o rainhas.exe -Wall -O2
+// Com contadores por profundidade (motores das versões 6, 7 e 8-3):
+// g++ rainhas.cpp ../../Biblioteca/rainhas.cpp -o rainhas.exe -Wall -O2 -DPERFIL_DE_BUSCA
+
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "../../Biblioteca/rainhas.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+int main()
+{
+    // Motor de busca:
+    unsigned int motor;
+    std::cout << "Motores de busca:" << std::endl;
+    for(unsigned int k = MOTOR_CONTADORES; k <= MOTOR_COBERTURA_EXATA; k++)
+    {
+        std::cout << "    " << k+1 << ": " << Rainhas::nome_do_motor(MotorDeBusca(k)) << std::endl;
+    }
+    std::cout << "Entre com o número do motor desejado: ";
+    std::cin >> motor;
+    if(motor < 1 || motor > MOTOR_COBERTURA_EXATA+1)
+    {
+        std::cout << "Erro. Motor inexistente." << std::endl;
+        return 0;
+    }
+
+    // Intervalo de números de possibilidades:
+    unsigned int x_min, x_max;
+    std::cout << "Entre com o menor e o maior número de possibilidades por dimensão desejados: ";
+    std::cin >> x_min >> x_max;
+    if(!x_min || x_max < x_min)
+    {
+        std::cout << "Erro. O intervalo deve ser de naturais não nulos e não vazio." << std::endl;
+        return 0;
+    }
+
+    // Repetições (como as chamadas sucessivas de um serviço):
+    unsigned int n_rep;
+    std::cout << "Entre com um número de repetições do intervalo: ";
+    std::cin >> n_rep;
+
+    // Quantidade de soluções guardadas e verificadas por x:
+    unsigned long long n_des;
+    std::cout << "Entre com um número de soluções a verificar por x (0 para todas): ";
+    std::cin >> n_des;
+
+    // O mesmo solucionador atende todas as chamadas:
+    Rainhas Q(MotorDeBusca(motor-1));
+    auto inicio = std::chrono::steady_clock::now();
+    for(unsigned int r = 0; r < n_rep; r++)
+    {
+        for(unsigned int x = x_min; x <= x_max; x++)
+        {
+            // Conta as soluções:
+            unsigned long long n = Q.conta(x);
+            // Guarda as primeiras e as verifica:
+            unsigned long long m = Q.primeiras(x, n_des);
+            unsigned long long n_f_sol = 0;
+            for(unsigned long long k = 0; k < m; k++)
+            {
+                if(!eh_solucao_de_bits(x, Q.solucao(k)))
+                {
+                    n_f_sol++;
+                }
+            }
+            // Imprime os resultados só na primeira repetição:
+            if(!r)
+            {
+                std::cout << "x = " << x << ": " << n << " soluções; " << m << " guardadas, das quais "
+                            << n_f_sol << " não são solução." << std::endl;
+            }
+        }
+    }
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+    std::cout << "Motor " << Rainhas::nome_do_motor(Q.motor()) << ": " << t << " s no total, "
+                << t/(double(n_rep)*(x_max-x_min+1)) << " s por x." << std::endl;
+
+#if defined(PERFIL_DE_BUSCA)
+    // Perfil por profundidade da busca completa do maior x:
+    Q.conta(x_max);
+    std::string nome = "perfil-" + std::to_string(x_max) + ".csv";
+    std::cout << "Perfil por profundidade para x = " << x_max << " (também em " << nome << "):" << std::endl;
+    Q.perfil().imprime(std::cout);
+    Q.perfil().exporta(nome.c_str());
+#endif
+    return 0;
+}
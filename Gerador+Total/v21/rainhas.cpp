@@ -0,0 +1,440 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+// Durante a busca completa, kill -USR1 <pid> imprime o progresso a qualquer
+// momento (exceto no Windows, que não tem o sinal; lá só há os relatórios por intervalo).
+
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <vector>
+#if !defined(_WIN32)
+#include <unistd.h> // getpid
+#endif
+
+#include "../../Biblioteca/aleatorio.hpp"
+
+// Número de nós entre consultas ao relógio e ao pedido de progresso:
+#define NOS_POR_CONSULTA_AO_RELOGIO (1u << 16)
+// Segundos de busca real usados para medir a taxa de nós por segundo:
+#define SEGUNDOS_DE_CALIBRACAO 0.5
+
+// Remoção de uma possibilidade do espaço de possibilidades de uma posição:
+typedef struct Remocao
+{
+    unsigned int p; // índice da posição.
+    unsigned int v; // possibilidade removida.
+} remocao;
+
+// Estrutura de estado de produção da gramática
+// desenvolvida para heurística observada:
+typedef struct Estado
+{
+    unsigned int i; // índice de profundidade.
+    unsigned int r; // coordenada de rainha.
+} estado;
+
+// Espaço de possibilidades com trilha de remoções (o mesmo da versão 8-3):
+typedef struct Espaco
+{
+    unsigned int x;                 // número de possibilidades.
+    std::vector<unsigned char> E;   // presença da possibilidade v na posição p (em E[p*x+v]).
+    std::vector<unsigned int> n;    // número de possibilidades presentes em cada posição.
+    std::vector<remocao> trilha;    // remoções, na ordem em que foram feitas.
+    unsigned int topo;              // número de remoções na trilha.
+    std::vector<unsigned int> marca;// topo da trilha antes das remoções de cada profundidade.
+} espaco;
+
+// Estimativa do tamanho da árvore de busca por sondas aleatórias:
+typedef struct Estimativa
+{
+    unsigned long long n_sondas;    // número de sondas.
+    double nos;                     // média das estimativas de nós.
+    double solucoes;                // média das estimativas de soluções.
+    double erro_nos;                // erro padrão da média de nós.
+    double erro_solucoes;           // erro padrão da média de soluções.
+} estimativa;
+
+// Acompanhamento de uma busca completa:
+typedef struct Progresso
+{
+    double intervalo;       // segundos entre relatórios (0 para nenhum).
+    double limite;          // segundos máximos de busca (0 para nenhum).
+    double nos_estimados;   // nós estimados da árvore (0 se não há estimativa).
+    std::chrono::steady_clock::time_point inicio;   // início da busca.
+} progresso;
+
+// Pedido de relatório de progresso, feito pelo sinal SIGUSR1:
+volatile sig_atomic_t pedido_de_progresso = 0;
+
+// Tratador do sinal SIGUSR1 (só marca o pedido; o relatório é feito pela busca):
+void trata_pedido_de_progresso(int)
+{
+    pedido_de_progresso = 1;
+}
+
+// Instala o tratador do pedido de progresso. Deve ser chamada no início do
+// programa: sem o tratador, um SIGUSR1 terminaria o processo:
+void instala_pedido_de_progresso()
+{
+#if !defined(_WIN32)
+    struct sigaction acao;
+    acao.sa_handler = trata_pedido_de_progresso;
+    sigemptyset(&acao.sa_mask);
+    acao.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &acao, NULL);
+#endif
+}
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço;
+// M: espaço a iniciar.
+void inicia_espaco(unsigned int x, espaco& M)
+{
+    M.x = x;
+    M.E.assign(x*x, 1);
+    M.n.assign(x, x);
+    M.trilha.resize(x*x);
+    M.topo = 0;
+    M.marca.assign(x, 0);
+}
+
+// i: profundidade a partir da qual as remoções são desfeitas;
+// M: espaço de possibilidades.
+inline void desfaz_remocoes(unsigned int i, espaco& M)
+{
+    // Desempilha a trilha até a marca da profundidade:
+    while(M.topo > M.marca[i])
+    {
+        remocao r = M.trilha[--M.topo];
+        // Reinsere a possibilidade removida:
+        M.E[r.p*M.x + r.v] = 1;
+        M.n[r.p]++;
+    }
+}
+
+// p    : índice da posição;
+// v    : possibilidade restringida;
+// M    : espaço de possibilidades.
+// Retorna verdadeiro se a remoção zerou as possibilidades da posição:
+inline bool remove_possibilidade(unsigned int p, unsigned int v, espaco& M)
+{
+    // Se a possibilidade está fora do tabuleiro ou já foi removida:
+    if(v >= M.x || !M.E[p*M.x + v])
+    {
+        return false;
+    }
+    // Remove e registra a remoção na trilha:
+    M.E[p*M.x + v] = 0;
+    M.n[p]--;
+    M.trilha[M.topo++] = {p, v};
+    return !M.n[p];
+}
+
+// i    : índice de rainha adicionada em solução parcial;
+// r    : coordenada da rainha;
+// M    : espaço de possibilidades.
+// Retorna verdadeiro se alguma remoção zerou as possibilidades de uma posição:
+bool remove_possibilidades(unsigned int i, unsigned int r, espaco& M)
+{
+    // Para todas as profundidades seguintes:
+    for(unsigned int j = 1; j <= (M.x-1)-i; j++)
+    {
+        // Remove da (i+j+1)-ésima posição as possibilidades de magnitude
+        // j unidades a esquerda, a própria e a de j unidades a direita da
+        // possibilidade usada pela (i+1)-ésima rainha:
+        if(remove_possibilidade(i+j, r-j, M) || remove_possibilidade(i+j, r, M) || remove_possibilidade(i+j, r+j, M))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sondas : número de sondas (não nulo);
+// semente  : semente do gerador aleatório;
+// M        : espaço de possibilidades (iniciado para x).
+// Estimador de Knuth: cada sonda desce da raiz a uma folha escolhendo ao
+// acaso uma das possibilidades restantes, com a mesma verificação adiante
+// da busca completa. Se as possibilidades das profundidades 0..d eram
+// c_0, ..., c_d, a sonda estima c_0*...*c_d nós na profundidade d (os
+// estados que a busca completa desempilharia ali) e, se chega à última
+// posição, o mesmo número de soluções. As médias são estimativas sem viés:
+estimativa estima_arvore(unsigned int x, unsigned long long n_sondas, uint64_t semente, espaco& M)
+{
+    Xoshiro256 g(semente);
+    // Somas das estimativas e de seus quadrados:
+    double s_nos = 0, q_nos = 0, s_sol = 0, q_sol = 0;
+    for(unsigned long long k = 0; k < n_sondas; k++)
+    {
+        // Volta ao espaço inicial (a marca da profundidade 0 é o início da trilha):
+        desfaz_remocoes(0, M);
+        double peso = 1, nos = 0, sol = 0;
+        for(unsigned int d = 0; ; d++)
+        {
+            // Estados da profundidade d que a busca completa visitaria nesta descida:
+            peso *= M.n[d];
+            nos += peso;
+            // Se é a posição de fim de solução, cada estado é uma solução:
+            if(d == x-1)
+            {
+                sol = peso;
+                break;
+            }
+            // Sorteia uma das possibilidades presentes:
+            unsigned int c = g.sorteia(M.n[d]);
+            unsigned int v = 0;
+            while(!M.E[d*x + v] || c--)
+            {
+                v++;
+            }
+            // Se a rainha zera alguma posição seguinte, a descida é um beco:
+            if(remove_possibilidades(d, v, M))
+            {
+                break;
+            }
+        }
+        s_nos += nos;
+        q_nos += nos*nos;
+        s_sol += sol;
+        q_sol += sol*sol;
+    }
+    desfaz_remocoes(0, M);
+
+    // Médias e erros padrão das médias:
+    estimativa A;
+    A.n_sondas = n_sondas;
+    A.nos = s_nos/n_sondas;
+    A.solucoes = s_sol/n_sondas;
+    A.erro_nos = A.erro_solucoes = 0;
+    if(n_sondas > 1)
+    {
+        A.erro_nos = std::sqrt(std::fmax(q_nos/n_sondas - A.nos*A.nos, 0.)/(n_sondas-1));
+        A.erro_solucoes = std::sqrt(std::fmax(q_sol/n_sondas - A.solucoes*A.solucoes, 0.)/(n_sondas-1));
+    }
+    return A;
+}
+
+// x        : número de possibilidades;
+// feitas   : subárvores da primeira posição concluídas;
+// nos      : nós visitados;
+// n_sol    : soluções contadas;
+// G        : acompanhamento da busca.
+// Imprime a fração concluída, a taxa de nós e o tempo restante estimado.
+// O tempo restante usa os nós estimados, se houver estimativa, ou a fração
+// de subárvores concluídas:
+void imprime_progresso(unsigned int x, unsigned int feitas, unsigned long long nos, unsigned long long n_sol, const progresso& G)
+{
+    double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-G.inicio).count();
+    double taxa = t > 0 ? nos/t : 0;
+    std::cout << "Progresso: " << feitas << "/" << x << " subárvores (" << 100.*feitas/x << "%), "
+                << nos << " nós";
+    double restante = -1;
+    if(G.nos_estimados > 0)
+    {
+        std::cout << " (" << 100.*nos/G.nos_estimados << "% da estimativa)";
+        if(taxa > 0)
+        {
+            restante = std::fmax(G.nos_estimados - nos, 0.)/taxa;
+        }
+    }
+    else if(feitas)
+    {
+        restante = t*(x-feitas)/feitas;
+    }
+    std::cout << ", " << taxa << " nós/s, " << n_sol << " soluções, " << t << " s decorridos, restam ";
+    if(restante < 0)
+    {
+        std::cout << "?";
+    }
+    else
+    {
+        std::cout << "~" << restante << " s";
+    }
+    std::cout << "." << std::endl;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// M        : espaço de possibilidades (iniciado para x);
+// G        : acompanhamento da busca;
+// n_sol    : soluções contadas;
+// nos      : nós visitados (estados desempilhados).
+// Mesma busca da versão 8-3, só contando. Relata o progresso a cada
+// intervalo e a cada SIGUSR1. Retorna falso se o limite de tempo a interrompeu:
+bool conta_solucoes(unsigned int x, espaco& M, const progresso& G, unsigned long long& n_sol, unsigned long long& nos)
+{
+    n_sol = 0;
+    nos = 0;
+    // Subárvores da primeira posição iniciadas (as raízes são desempilhadas
+    // em sequência, então todas as iniciadas antes da atual estão concluídas):
+    unsigned int iniciadas = 0;
+    // Momento do último relatório:
+    auto ultimo = G.inicio;
+
+    // Pilha para executar recursão (no máximo x estados por profundidade):
+    std::vector<estado> pilha;
+    pilha.reserve(x*x);
+    std::vector<unsigned int> S(x);
+
+    // Para todas as possibilidades, empilha estado inicial:
+    for(unsigned int p = 0; p <= x-1; p++)
+    {
+        pilha.push_back({0, p});
+    }
+
+    // Enquanto houver estados:
+    while(!pilha.empty())
+    {
+        // Pega e desempilha o estado no topo da pilha:
+        estado q = pilha.back();
+        pilha.pop_back();
+        nos++;
+        if(!q.i)
+        {
+            iniciadas++;
+        }
+
+        // Se é hora de consultar o relógio e o pedido de progresso:
+        if(!(nos % NOS_POR_CONSULTA_AO_RELOGIO))
+        {
+            auto agora = std::chrono::steady_clock::now();
+            // Se passou o intervalo ou houve pedido por sinal:
+            if(pedido_de_progresso || (G.intervalo > 0 && std::chrono::duration<double>(agora-ultimo).count() >= G.intervalo))
+            {
+                pedido_de_progresso = 0;
+                imprime_progresso(x, iniciadas-1, nos, n_sol, G);
+                ultimo = agora;
+            }
+            // Se atingiu o limite de tempo:
+            if(G.limite > 0 && std::chrono::duration<double>(agora-G.inicio).count() >= G.limite)
+            {
+                desfaz_remocoes(0, M);
+                return false;
+            }
+        }
+
+        // Desfaz as remoções das rainhas de profundidade q.i em diante:
+        desfaz_remocoes(q.i, M);
+        S[q.i] = q.r;
+
+        // Se é a posição de fim de solução:
+        if(q.i == x-1)
+        {
+            n_sol++;
+            continue;
+        }
+
+        // Se as remoções não zeram as possibilidades de nenhuma posição:
+        if(!remove_possibilidades(q.i, q.r, M))
+        {
+            // Marca o início das remoções dos estados da posição seguinte:
+            M.marca[q.i+1] = M.topo;
+            // Para todas as possibilidades da posição seguinte:
+            for(unsigned int v = 0; v < x; v++)
+            {
+                if(M.E[(q.i+1)*x + v])
+                {
+                    // Empilha o uso da possibilidade:
+                    pilha.push_back({q.i+1, v});
+                }
+            }
+        }
+    }
+    desfaz_remocoes(0, M);
+    return true;
+}
+
+int main()
+{
+    // Pedidos de progresso chegados durante a estimativa e a calibração não terminam o processo:
+    instala_pedido_de_progresso();
+
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo:
+    if(!x)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        return 0;
+    }
+
+    // Sondas do estimador:
+    unsigned long long n_sondas;
+    std::cout << "Entre com um número de sondas aleatórias para estimar a árvore (0 para não estimar): ";
+    std::cin >> n_sondas;
+    uint64_t semente;
+    std::cout << "Entre com uma semente (0 para aleatória): ";
+    std::cin >> semente;
+    if(!semente)
+    {
+        semente = semente_aleatoria();
+    }
+
+    // Espaço de possibilidades, usado pelo estimador e pela busca:
+    espaco M;
+    inicia_espaco(x, M);
+
+    // Acompanhamento da busca:
+    progresso G;
+    G.intervalo = 0;
+    G.limite = 0;
+    G.nos_estimados = 0;
+
+    // Se pediu estimativa:
+    if(n_sondas)
+    {
+        auto inicio = std::chrono::steady_clock::now();
+        estimativa A = estima_arvore(x, n_sondas, semente, M);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now()-inicio).count();
+        std::cout << "Semente: " << semente << std::endl;
+        std::cout << "Estimativa com " << A.n_sondas << " sondas (" << t << " s): " << A.nos << " ± " << A.erro_nos
+                    << " nós e " << A.solucoes << " ± " << A.erro_solucoes << " soluções." << std::endl;
+        G.nos_estimados = A.nos;
+
+        // Mede a taxa de nós por segundo com um trecho da busca completa:
+        unsigned long long n_sol, nos;
+        G.limite = SEGUNDOS_DE_CALIBRACAO;
+        G.inicio = std::chrono::steady_clock::now();
+        bool completa = conta_solucoes(x, M, G, n_sol, nos);
+        t = std::chrono::duration<double>(std::chrono::steady_clock::now()-G.inicio).count();
+        G.limite = 0;
+        if(completa)
+        {
+            std::cout << "A busca completa terminou na calibração (" << t << " s, " << nos << " nós): "
+                        << n_sol << " soluções." << std::endl;
+        }
+        else
+        {
+            std::cout << "Taxa medida: " << nos/t << " nós/s; tempo estimado da busca completa: "
+                        << A.nos/(nos/t) << " s." << std::endl;
+        }
+    }
+
+    // Busca completa:
+    unsigned int executa;
+    std::cout << "Entre com 1 para executar a busca completa ou 0 para só estimar: ";
+    std::cin >> executa;
+    if(!executa)
+    {
+        return 0;
+    }
+    std::cout << "Entre com um intervalo entre relatórios de progresso em segundos (0 para nenhum): ";
+    std::cin >> G.intervalo;
+
+#if !defined(_WIN32)
+    std::cout << "Para o progresso a qualquer momento: kill -USR1 " << getpid() << std::endl;
+#endif
+
+    unsigned long long n_sol, nos;
+    G.inicio = std::chrono::steady_clock::now();
+    conta_solucoes(x, M, G, n_sol, nos);
+    imprime_progresso(x, x, nos, n_sol, G);
+
+    std::cout << "Número de nós visitados: " << nos << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol << std::endl;
+    return 0;
+}
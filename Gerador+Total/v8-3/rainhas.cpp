@@ -0,0 +1,232 @@
+// Para compilar:
+// g++ rainhas.cpp -o rainhas.exe -Wall -O2
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+#include "../../Biblioteca/sumidouro.hpp"
+#include "../../Biblioteca/verificador.hpp"
+
+// Remoção de uma possibilidade do espaço de possibilidades de uma posição:
+typedef struct Remocao
+{
+    unsigned int p; // índice da posição.
+    unsigned int v; // possibilidade removida.
+} remocao;
+
+// Estrutura de estado de produção da gramática
+// desenvolvida para heurística observada:
+typedef struct Estado
+{
+    unsigned int i; // índice de profundidade.
+    unsigned int r; // coordenada de rainha.
+} estado;
+
+// Espaço de possibilidades com trilha de remoções. Substitui o vetor de
+// conjuntos E e a matriz triangular de conjuntos mem da versão 8: cada
+// posição tem um vetor de presença, as remoções de todas as rainhas são
+// registradas em sequência em uma única trilha, e a trilha guarda a marca
+// de onde começam as remoções de cada profundidade. Desfazer as remoções
+// a partir de uma profundidade é desempilhar a trilha até a sua marca:
+typedef struct Espaco
+{
+    unsigned int x;                 // número de possibilidades.
+    std::vector<unsigned char> E;   // presença da possibilidade v na posição p (em E[p*x+v]).
+    std::vector<unsigned int> n;    // número de possibilidades presentes em cada posição.
+    std::vector<remocao> trilha;    // remoções, na ordem em que foram feitas.
+    unsigned int topo;              // número de remoções na trilha.
+    std::vector<unsigned int> marca;// topo da trilha antes das remoções de cada profundidade
+                                    // (definido quando os estados da profundidade são empilhados).
+} espaco;
+
+// x: número de possibilidades de valor de coordenada de dimensão de um espaço;
+// M: espaço a iniciar.
+// Toda a memória da busca é alocada aqui, antes do loop:
+void inicia_espaco(unsigned int x, espaco& M)
+{
+    M.x = x;
+    M.E.assign(x*x, 1);
+    M.n.assign(x, x);
+    // Cada possibilidade de cada posição é removida no máximo uma vez
+    // enquanto ausente, então a trilha nunca excede x*x remoções:
+    M.trilha.resize(x*x);
+    M.topo = 0;
+    M.marca.assign(x, 0);
+}
+
+// i: profundidade a partir da qual as remoções são desfeitas;
+// M: espaço de possibilidades.
+inline void desfaz_remocoes(unsigned int i, espaco& M)
+{
+    // Desempilha a trilha até a marca da profundidade:
+    while(M.topo > M.marca[i])
+    {
+        remocao r = M.trilha[--M.topo];
+        // Reinsere a possibilidade removida:
+        M.E[r.p*M.x + r.v] = 1;
+        M.n[r.p]++;
+    }
+}
+
+// p    : índice da posição;
+// v    : possibilidade restringida;
+// M    : espaço de possibilidades.
+// Retorna verdadeiro se a remoção zerou as possibilidades da posição:
+inline bool remove_possibilidade(unsigned int p, unsigned int v, espaco& M)
+{
+    // Se a possibilidade está fora do tabuleiro ou já foi removida:
+    if(v >= M.x || !M.E[p*M.x + v])
+    {
+        return false;
+    }
+    // Remove e registra a remoção na trilha:
+    M.E[p*M.x + v] = 0;
+    M.n[p]--;
+    M.trilha[M.topo++] = {p, v};
+    return !M.n[p];
+}
+
+// i    : índice de rainha adicionada em solução parcial;
+// r    : coordenada da rainha;
+// M    : espaço de possibilidades.
+// Retorna verdadeiro se alguma remoção zerou as possibilidades de uma posição:
+bool remove_possibilidades(unsigned int i, unsigned int r, espaco& M)
+{
+    // Para todas as profundidades seguintes:
+    for(unsigned int j = 1; j <= (M.x-1)-i; j++)
+    {
+        // Remove da (i+j+1)-ésima posição as possibilidades de magnitude
+        // j unidades a esquerda, a própria e a de j unidades a direita da
+        // possibilidade usada pela (i+1)-ésima rainha:
+        if(remove_possibilidade(i+j, r-j, M) || remove_possibilidade(i+j, r, M) || remove_possibilidade(i+j, r+j, M))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// x    : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// s    : destino das soluções.
+// Mesma busca da versão 8 (mesmos estados, na mesma ordem), sem
+// alocação no loop. Retorna falso se o destino interrompeu a geração:
+bool gera_solucoes(unsigned int x, Sumidouro& s)
+{
+    // Espaço de possibilidades com trilha de remoções:
+    espaco M;
+    inicia_espaco(x, M);
+
+    // Coordenadas das rainhas posicionadas (solução parcial):
+    std::vector<unsigned int> S(x);
+
+    // Pilha para executar recursão (no máximo x estados por profundidade):
+    std::vector<estado> pilha;
+    pilha.reserve(x*x);
+
+    // Para todas as possibilidades, empilha estado inicial:
+    for(unsigned int p = 0; p <= x-1; p++)
+    {
+        pilha.push_back({0, p});
+    }
+
+    // Enquanto houver estados:
+    while(!pilha.empty())
+    {
+        // Pega e desempilha o estado no topo da pilha:
+        estado q = pilha.back();
+        pilha.pop_back();
+
+        // Desfaz as remoções das rainhas de profundidade q.i em diante
+        // (as que o estado substitui):
+        desfaz_remocoes(q.i, M);
+        // Salva uso da possibilidade atual:
+        S[q.i] = q.r;
+
+        // Se o índice do estado atual é o de uma
+        // possibilidade para rainha em fim de solução:
+        if(q.i == x-1)
+        {
+            // Entrega a solução e, se o destino pede, interrompe:
+            if(!s.recebe(x, S.data()))
+            {
+                s.finaliza();
+                return false;
+            }
+            continue;
+        }
+
+        // Se as remoções não zeram as possibilidades de nenhuma posição:
+        if(!remove_possibilidades(q.i, q.r, M))
+        {
+            // Marca o início das remoções dos estados da posição seguinte:
+            M.marca[q.i+1] = M.topo;
+            // Para todas as possibilidades da posição seguinte:
+            for(unsigned int v = 0; v < x; v++)
+            {
+                if(M.E[(q.i+1)*x + v])
+                {
+                    // Empilha o uso da possibilidade:
+                    pilha.push_back({q.i+1, v});
+                }
+            }
+        }
+    }
+
+    s.finaliza();
+    return true;
+}
+
+// x        : número de possibilidades de valor de coordenada de dimensão de um espaço;
+// n_sol    : número de soluções encontradas;
+// R        : soluções encontradas.
+// Mantém a interface das versões anteriores:
+void gera_solucoes(unsigned int x, unsigned int* n_sol, unsigned int*** R)
+{
+    SumidouroDeConjunto s(n_sol, R);
+    gera_solucoes(x, s);
+}
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nula:
+    if(!x)
+    {
+        std::cout << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        return 0;
+    }
+
+    // Conjunto de soluções:
+    unsigned int** R = (unsigned int**)malloc(sizeof(unsigned int*));
+    // Número de soluções:
+    unsigned int n_sol = 0;
+    // Gera as soluções:
+    gera_solucoes(x, &n_sol, &R);
+    // Número de falsas soluções:
+    unsigned int n_f_sol = 0;
+    // Para todas as supostas soluções:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Se não for de fato solução:
+        if(!eh_solucao_de_bits(x, R[i]))
+        {
+            n_f_sol++;
+        }
+    }
+    std::cout << "Número de sequências geradas que não são solução do problema: " << n_f_sol << std::endl;
+    std::cout << "Número de soluções encontradas para o problema (2, " << x << ")-Rainhas Padrão: " << n_sol-n_f_sol << std::endl;
+
+    // Libera a memória alocada:
+    for(unsigned int i = 0; i < n_sol; i++)
+    {
+        // Libera a (i+1)-ésima solução:
+        free(R[i]);
+    }
+    free(R);
+    return 0;
+}
@@ -0,0 +1,120 @@
+// Para compilar:
+// g++ analises.cpp Biblioteca/rainhas.cpp -o analises.exe -Wall -O2 -pthread
+
+#include <iostream>
+#include <thread>
+
+#include "Biblioteca/analisadores.hpp"
+#include "Biblioteca/areas.hpp"
+#include "Biblioteca/exclusoes.hpp"
+
+// Exemplo de analisador definido pelo usuário: conta, para cada posição,
+// as soluções cuja rainha daquela posição está na borda do tabuleiro:
+class AnalisadorDeBordas : public Analisador
+{
+    public:
+        void analisa(unsigned int x, const unsigned int* S) override
+        {
+            if(this->B.size() < x)
+            {
+                this->B.resize(x, 0);
+            }
+            for(unsigned int k = 0; k < x; k++)
+            {
+                // Se a rainha está na primeira ou na última coordenada:
+                if(!S[k] || S[k] == x-1)
+                {
+                    this->B[k]++;
+                }
+            }
+        }
+        std::unique_ptr<Analisador> novo() const override
+        {
+            return std::unique_ptr<Analisador>(new AnalisadorDeBordas());
+        }
+        void junta(const Analisador& outro) override
+        {
+            const std::vector<unsigned long long>& O = static_cast<const AnalisadorDeBordas&>(outro).B;
+            if(this->B.size() < O.size())
+            {
+                this->B.resize(O.size(), 0);
+            }
+            for(size_t k = 0; k < O.size(); k++)
+            {
+                this->B[k] += O[k];
+            }
+        }
+        void relata(std::ostream& o) const override
+        {
+            o << "Soluções com rainha na borda, por posição: ";
+            for(size_t k = 0; k < this->B.size(); k++)
+            {
+                o << (k ? ", " : "") << this->B[k];
+            }
+            o << std::endl;
+        }
+    private:
+        // Soluções com rainha na borda em cada posição:
+        std::vector<unsigned long long> B;
+};
+
+int main()
+{
+    // Número de possibilidades de valores para as coordenadas de uma casa de um (2, x)-tabuleiro:
+    unsigned int x;
+    std::cout << "Entre com um número de possibilidades por dimensão desejado: ";
+    std::cin >> x;
+
+    // Se número nulo:
+    if(!x)
+    {
+        std::cerr << "Erro. O número de possibilidades deve ser um natural não nulo." << std::endl;
+        return 0;
+    }
+
+    // Número de linhas de execução:
+    unsigned int n_t;
+    std::cout << "Entre com um número de linhas de execução (0 para o número de núcleos): ";
+    std::cin >> n_t;
+    if(!n_t)
+    {
+        n_t = std::thread::hardware_concurrency();
+    }
+
+    // Análises desejadas (a validação é sempre feita):
+    unsigned int areas, exclusoes, bordas;
+    std::cout << "Entre com 1 para o histograma de áreas ou 0 para não: ";
+    std::cin >> areas;
+    std::cout << "Entre com 1 para o histograma de somas de exclusões ou 0 para não: ";
+    std::cin >> exclusoes;
+    std::cout << "Entre com 1 para a contagem de rainhas nas bordas ou 0 para não: ";
+    std::cin >> bordas;
+
+    // Todas as análises são alimentadas pela mesma enumeração:
+    Analises A;
+    A.adiciona(new AnalisadorDeValidacao(x));
+    if(areas)
+    {
+        A.adiciona(new AnalisadorDeHistograma("áreas", [](unsigned int x, const unsigned int* S)
+        {
+            return double(area_dupla_de_solucao(x, S))/2;
+        }));
+    }
+    if(exclusoes)
+    {
+        A.adiciona(new AnalisadorDeHistograma("somas", [](unsigned int x, const unsigned int* S)
+        {
+            return double(conta_exclusoes(x, S));
+        }));
+    }
+    if(bordas)
+    {
+        A.adiciona(new AnalisadorDeBordas());
+    }
+
+    // Enumera uma única vez, em paralelo, e junta os resultados parciais:
+    analisa_solucoes(x, A, n_t);
+    A.relata(std::cout);
+
+    return 0;
+}